@@ -1,9 +1,30 @@
-QT += gui
+QT += gui widgets
+
+# CONFIG += qsourcehighlite_trace compiles in QSourceHighliteTracer
+qsourcehighlite_trace: DEFINES += QSOURCEHIGHLITE_TRACE
+
+# the highlighter uses the tables tools/languagetablesgen generates from
+# languagedata.cpp, which is still built for its loadXxxData() functions
 
 HEADERS += $$PWD/qsourcehighliter.h \
            $$PWD/qsourcehighliterthemes.h \
-           $$PWD/languagedata.h
+           $$PWD/languagedata.h \
+           $$PWD/keywordtable.h \
+           $$PWD/languagetables.h \
+           $$PWD/languageregistry.h \
+           $$PWD/grammarformat.h \
+           $$PWD/textscanner.h \
+           $$PWD/qsourcetokenizer.h \
+           $$PWD/qsourcehighlightscheduler.h \
+           $$PWD/qsourcehighlitetracer.h
 
 SOURCES += $$PWD/qsourcehighliter.cpp \
     $$PWD/languagedata.cpp \
+    $$PWD/keywordtable.cpp \
+    $$PWD/languagetables.cpp \
+    $$PWD/languageregistry.cpp \
+    $$PWD/textscanner.cpp \
+    $$PWD/qsourcetokenizer.cpp \
+    $$PWD/qsourcehighlightscheduler.cpp \
+    $$PWD/qsourcehighlitetracer.cpp \
     $$PWD/qsourcehighliterthemes.cpp
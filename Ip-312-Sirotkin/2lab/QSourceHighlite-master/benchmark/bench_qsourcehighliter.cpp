@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Highlighting benchmark.
+ *
+ * The samples in test_files/ are repeated into corpora of 10k, 100k and 1M
+ * lines, one per language, each from that language's own sample. A
+ * language whose sample is missing is reported and skipped. Runs headless:
+ *
+ *   bench_qsourcehighliter [--json file] [--trace file] [--samples dir] [lines...]
+ *
+ * Every corpus goes through these phases:
+ *
+ *   highlight    the first rehighlight() of the document
+ *   rehighlight  rehighlight() again, every block is a cache hit
+ *   parallel     rehighlightParallel()
+ *   theme        setTheme()
+ *   edit         100 single character insertions spread over the document
+ *
+ * For each phase it prints lines/s, the p50 and p99 time one block takes
+ * to highlight (one edit for the edit phase), the heap allocations made
+ * per block inside highlightBlock() and the peak RSS of the process so
+ * far. --json writes the same numbers to a file.
+ *
+ * Rehighlighting an unchanged document must not allocate, so the
+ * benchmark exits with 1 if the rehighlight phase does.
+ *
+ * --trace records everything with QSourceHighliteTracer, writes it as a
+ * Chrome trace and prints the tracer's summary. That needs a build with
+ * CONFIG += qsourcehighlite_trace, and the tracer allocates, so the
+ * allocation check is skipped.
+ */
+
+#include "qsourcehighliter.h"
+#include "qsourcehighlitetracer.h"
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextStream>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace QSourceHighlite;
+
+/*
+ * Allocation counting. Qt's containers allocate through malloc() rather than
+ * operator new, so on glibc malloc and its aligned variants are interposed;
+ * elsewhere only operator new is seen.
+ */
+static thread_local quint64 allocationCount = 0;
+
+#if defined(__GLIBC__)
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size)
+{
+    ++allocationCount;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size)
+{
+    ++allocationCount;
+    return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    ++allocationCount;
+    return __libc_realloc(ptr, size);
+}
+
+// glibc only exports __libc_memalign, the other aligned allocators go
+// through it
+void *memalign(size_t alignment, size_t size)
+{
+    ++allocationCount;
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    ++allocationCount;
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    ++allocationCount;
+    void *p = __libc_memalign(alignment, size);
+    if (!p)
+        return ENOMEM;
+    *ptr = p;
+    return 0;
+}
+}
+#else
+void *operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+#endif
+
+/**
+ * @brief the peak resident set size of the process in KiB, -1 if unknown
+ */
+static qint64 peakRssKiB()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return -1;
+    return qint64(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#if defined(Q_OS_DARWIN)
+    // bytes on macOS, KiB elsewhere
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/**
+ * @brief records how long each block takes to highlight and how many
+ * allocations it makes
+ */
+class RecordingHighliter : public QSourceHighliter
+{
+public:
+    using QSourceHighliter::QSourceHighliter;
+
+    bool recording = false;
+    quint64 allocations = 0;
+    QVector<qint64> blockNs;
+
+protected:
+    void highlightBlock(const QString &text) override
+    {
+        if (!recording) {
+            QSourceHighliter::highlightBlock(text);
+            return;
+        }
+        QElapsedTimer timer;
+        timer.start();
+        const quint64 before = allocationCount;
+        QSourceHighliter::highlightBlock(text);
+        allocations += allocationCount - before;
+        // the vector is reserved up front, this doesn't allocate
+        blockNs.append(timer.nsecsElapsed());
+    }
+};
+
+static const struct {
+    const char *name;
+    QSourceHighliter::Language language;
+    const char *file;
+} languages[] = {
+    { "Asm",        QSourceHighliter::CodeAsm,        "Asm.txt" },
+    { "Bash",       QSourceHighliter::CodeBash,       "Bash.txt" },
+    { "C",          QSourceHighliter::CodeC,          "C.txt" },
+    { "C++",        QSourceHighliter::CodeCpp,        "C++.txt" },
+    { "C#",         QSourceHighliter::CodeCSharp,     "CSharp.txt" },
+    { "CMake",      QSourceHighliter::CodeCMake,      "CMake.txt" },
+    { "CSS",        QSourceHighliter::CodeCSS,        "Css.txt" },
+    { "Go",         QSourceHighliter::CodeGo,         "Go.txt" },
+    { "INI",        QSourceHighliter::CodeINI,        "Ini.txt" },
+    { "Java",       QSourceHighliter::CodeJava,       "Java.txt" },
+    { "Javascript", QSourceHighliter::CodeJs,         "Javascript.txt" },
+    { "JSON",       QSourceHighliter::CodeJSON,       "Json.txt" },
+    { "Lua",        QSourceHighliter::CodeLua,        "Lua.txt" },
+    { "Make",       QSourceHighliter::CodeMake,       "Make.txt" },
+    { "PHP",        QSourceHighliter::CodePHP,        "Php.txt" },
+    { "Python",     QSourceHighliter::CodePython,     "Python.txt" },
+    { "QML",        QSourceHighliter::CodeQML,        "Qml.txt" },
+    { "Rhai",       QSourceHighliter::CodeRhai,       "Rhai.txt" },
+    { "Rust",       QSourceHighliter::CodeRust,       "Rust.txt" },
+    { "SQL",        QSourceHighliter::CodeSQL,        "Sql.txt" },
+    { "Typescript", QSourceHighliter::CodeTypeScript, "Typescript.txt" },
+    { "V",          QSourceHighliter::CodeV,          "V.txt" },
+    { "Vex",        QSourceHighliter::CodeVex,        "Vex.txt" },
+    { "XML",        QSourceHighliter::CodeXML,        "Xml.txt" },
+    { "YAML",       QSourceHighliter::CodeYAML,       "Yaml.txt" },
+};
+
+/**
+ * @brief repeats the sample until the text has at least lines lines
+ */
+static QString scaleSample(const QString &sample, int lines)
+{
+    const int sampleLines = sample.count(QLatin1Char('\n')) + 1;
+    const int copies = (lines + sampleLines - 1) / sampleLines;
+
+    QString text;
+    text.reserve((sample.size() + 1) * copies);
+    for (int i = 0; i < copies; ++i) {
+        text += sample;
+        text += QLatin1Char('\n');
+    }
+    return text;
+}
+
+/**
+ * @brief returns the p-th percentile of the sorted values
+ */
+static qint64 percentile(const QVector<qint64> &sorted, double p)
+{
+    if (sorted.isEmpty())
+        return 0;
+    const int i = qMin(int(sorted.size() * p), sorted.size() - 1);
+    return sorted.at(i);
+}
+
+struct PhaseResult {
+    QString phase;
+    int blocks;
+    qint64 ns;
+    qint64 p50Ns;
+    qint64 p99Ns;
+    double allocationsPerBlock;
+    qint64 peakRssKiB;
+};
+
+/**
+ * @brief runs one phase with the highlighter recording
+ * @param samples the times to take percentiles of, the recorded block
+ * times if null
+ */
+static PhaseResult measure(const QString &phase, RecordingHighliter &highlighter,
+                           const std::function<void()> &run,
+                           QVector<qint64> *samples = nullptr)
+{
+    QTextDocument *doc = highlighter.document();
+    highlighter.blockNs.resize(0);
+    highlighter.blockNs.reserve(doc->blockCount() * 2);
+    highlighter.allocations = 0;
+
+    QElapsedTimer timer;
+    highlighter.recording = true;
+    timer.start();
+    run();
+    const qint64 ns = timer.nsecsElapsed();
+    highlighter.recording = false;
+
+    QVector<qint64> &times = samples ? *samples : highlighter.blockNs;
+    std::sort(times.begin(), times.end());
+
+    PhaseResult r;
+    r.phase = phase;
+    r.blocks = highlighter.blockNs.size();
+    r.ns = ns;
+    r.p50Ns = percentile(times, 0.50);
+    r.p99Ns = percentile(times, 0.99);
+    r.allocationsPerBlock = r.blocks ? double(highlighter.allocations) / r.blocks : 0;
+    r.peakRssKiB = peakRssKiB();
+    return r;
+}
+
+/**
+ * @brief inserts a character into edits lines spread over the document,
+ * recording how long each insertion takes
+ */
+static void editLines(QTextDocument *doc, int edits, QVector<qint64> &editNs)
+{
+    const int blocks = doc->blockCount();
+    QElapsedTimer timer;
+    for (int i = 0; i < edits; ++i) {
+        QTextCursor cursor(doc->findBlockByNumber(int(qint64(blocks) * i / edits)));
+        timer.start();
+        cursor.insertText(QStringLiteral("x"));
+        editNs.append(timer.nsecsElapsed());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("QSourceHighliter benchmark"));
+    parser.addHelpOption();
+    const QCommandLineOption jsonOption(QStringLiteral("json"),
+                                        QStringLiteral("Write the results as JSON to <file>."),
+                                        QStringLiteral("file"));
+    const QCommandLineOption samplesOption(QStringLiteral("samples"),
+                                           QStringLiteral("Read the samples from <dir>."),
+                                           QStringLiteral("dir"),
+                                           QStringLiteral(TEST_FILES_DIR));
+    const QCommandLineOption traceOption(QStringLiteral("trace"),
+                                         QStringLiteral("Write a Chrome trace to <file>."),
+                                         QStringLiteral("file"));
+    parser.addOption(jsonOption);
+    parser.addOption(traceOption);
+    parser.addOption(samplesOption);
+    parser.addPositionalArgument(QStringLiteral("lines"),
+                                 QStringLiteral("Corpus sizes, 10000 100000 1000000 by default."),
+                                 QStringLiteral("[lines...]"));
+    parser.process(app);
+
+    QVector<int> sizes;
+    for (const QString &arg : parser.positionalArguments())
+        sizes.append(arg.toInt());
+    if (sizes.isEmpty())
+        sizes = { 10000, 100000, 1000000 };
+    const QDir dir(parser.value(samplesOption));
+    const bool tracing = parser.isSet(traceOption);
+    QSourceHighliteTracer::setEnabled(tracing);
+
+    QTextStream out(stdout);
+    out << QStringLiteral("%1 %2 %3 %4 %5 %6 %7 %8 %9\n")
+           .arg(QStringLiteral("language"), -10)
+           .arg(QStringLiteral("lines"), 8)
+           .arg(QStringLiteral("phase"), -11)
+           .arg(QStringLiteral("ms"), 10)
+           .arg(QStringLiteral("lines/s"), 12)
+           .arg(QStringLiteral("p50 us"), 8)
+           .arg(QStringLiteral("p99 us"), 8)
+           .arg(QStringLiteral("allocs/line"), 12)
+           .arg(QStringLiteral("peak MiB"), 9);
+
+    QJsonArray results;
+    bool allocationFree = true;
+
+    for (const auto &language : languages) {
+        QFile f(dir.filePath(QLatin1String(language.file)));
+        if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            out << "skipping " << language.name << ", no sample: " << f.fileName() << ": "
+                << f.errorString() << "\n";
+            continue;
+        }
+        const QString sample = QString::fromUtf8(f.readAll()).trimmed();
+
+        for (const int lines : qAsConst(sizes)) {
+            QTextDocument doc;
+            doc.setPlainText(scaleSample(sample, lines));
+            RecordingHighliter highlighter(&doc);
+            highlighter.setCurrentLanguage(language.language);
+
+            QVector<PhaseResult> phases;
+            phases.append(measure(QStringLiteral("highlight"), highlighter,
+                                  [&] { highlighter.rehighlight(); }));
+            phases.append(measure(QStringLiteral("rehighlight"), highlighter,
+                                  [&] { highlighter.rehighlight(); }));
+            if (phases.last().allocationsPerBlock != 0)
+                allocationFree = false;
+            phases.append(measure(QStringLiteral("parallel"), highlighter,
+                                  [&] { highlighter.rehighlightParallel(); }));
+            phases.append(measure(QStringLiteral("theme"), highlighter,
+                                  [&] { highlighter.setTheme(QSourceHighliter::Monokai); }));
+            QVector<qint64> editNs;
+            phases.append(measure(QStringLiteral("edit"), highlighter,
+                                  [&] { editLines(&doc, 100, editNs); }, &editNs));
+
+            for (const PhaseResult &r : qAsConst(phases)) {
+                // for edits, lines/s counts the rehighlighted lines
+                const double linesPerSecond = r.blocks / (r.ns / 1e9);
+                out << QStringLiteral("%1 %2 %3 %4 %5 %6 %7 %8 %9\n")
+                       .arg(QLatin1String(language.name), -10)
+                       .arg(doc.blockCount(), 8)
+                       .arg(r.phase, -11)
+                       .arg(r.ns / 1e6, 10, 'f', 1)
+                       .arg(linesPerSecond, 12, 'f', 0)
+                       .arg(r.p50Ns / 1e3, 8, 'f', 2)
+                       .arg(r.p99Ns / 1e3, 8, 'f', 2)
+                       .arg(r.allocationsPerBlock, 12, 'f', 3)
+                       .arg(r.peakRssKiB / 1024.0, 9, 'f', 1);
+
+                QJsonObject result;
+                result[QStringLiteral("language")] = QLatin1String(language.name);
+                result[QStringLiteral("lines")] = doc.blockCount();
+                result[QStringLiteral("phase")] = r.phase;
+                result[QStringLiteral("blocks")] = r.blocks;
+                result[QStringLiteral("ms")] = r.ns / 1e6;
+                result[QStringLiteral("linesPerSecond")] = linesPerSecond;
+                result[QStringLiteral("p50Us")] = r.p50Ns / 1e3;
+                result[QStringLiteral("p99Us")] = r.p99Ns / 1e3;
+                result[QStringLiteral("allocationsPerBlock")] = r.allocationsPerBlock;
+                result[QStringLiteral("peakRssKiB")] = r.peakRssKiB;
+                results.append(result);
+            }
+            out.flush();
+        }
+    }
+
+    if (parser.isSet(jsonOption)) {
+        QJsonObject root;
+        root[QStringLiteral("qtVersion")] = QLatin1String(qVersion());
+        root[QStringLiteral("results")] = results;
+
+        QFile json(parser.value(jsonOption));
+        if (!json.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            out << "can't write " << json.fileName() << ": " << json.errorString() << "\n";
+            return 2;
+        }
+        json.write(QJsonDocument(root).toJson());
+    }
+
+    if (tracing) {
+        out << "\n" << QSourceHighliteTracer::summary();
+        if (!QSourceHighliteTracer::writeChromeTrace(parser.value(traceOption))) {
+            out << "can't write " << parser.value(traceOption) << "\n";
+            return 2;
+        }
+        return 0;
+    }
+
+    return allocationFree ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+QT       += core gui
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TARGET = bench_qsourcehighliter
+
+include(../QSourceHighlite.pri)
+
+INCLUDEPATH += $$PWD/..
+
+DEFINES += QT_DEPRECATED_WARNINGS
+DEFINES += TEST_FILES_DIR=\\\"$$PWD/../test_files\\\"
+
+win32: LIBS += -lpsapi
+
+SOURCES += \
+    bench_qsourcehighliter.cpp
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef GRAMMARFORMAT_H
+#define GRAMMARFORMAT_H
+
+#include <cstdint>
+
+/*
+ * The binary grammar format, written by tools/grammarcompiler and mapped
+ * into memory by loadGrammarFile(). This header is shared by both and
+ * doesn't depend on Qt.
+ *
+ * All numbers are little-endian and every offset is from the start of the
+ * file. A file is:
+ *
+ *   GrammarHeader
+ *   GrammarLanguage[languageCount]
+ *   the word pool, the words followed by the language names
+ *   per language, 4-byte aligned: KeywordSlot[entryCount] and
+ *   quint16 displacements[bucketCount]
+ *
+ * The keyword tables are the same perfect hash tables (power-of-two
+ * table) as the generated ones in languagetables.cpp and are used in
+ * place, without copying.
+ */
+
+namespace QSourceHighlite {
+
+static const char grammarMagic[4] = { 'Q', 'S', 'H', 'G' };
+// bumped whenever the layout or the meaning of a field changes. 2: the
+// reserved byte after GrammarLanguage::displacementsOffset became
+// numberSuffixes, older files have garbage there. 3: ' only separates
+// digits with the digit-quotes flag, which older files don't set for C++
+static const uint16_t grammarVersion = 3;
+
+struct GrammarHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t languageCount;
+    uint32_t languagesOffset;
+    uint32_t poolOffset;
+    uint32_t poolSize;
+    uint32_t fileSize;
+    uint32_t reserved[2];
+};
+
+struct GrammarLanguage {
+    // the value passed as QSourceHighliter::Language, even and below 256
+    uint16_t id;
+    // the line comment character, 0 for // and /* */ comments
+    uint8_t lineComment;
+    uint8_t maxLength;
+    // CompiledLanguage::Flag
+    uint32_t flags;
+    uint32_t nameOffset;
+    uint16_t nameLength;
+    uint16_t bucketCount;
+    uint32_t entriesOffset;
+    uint32_t entryCount;
+    uint32_t displacementsOffset;
+    // CompiledLanguage::NumberSuffixes
+    uint8_t numberSuffixes;
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(GrammarHeader) == 32, "GrammarHeader must not have padding");
+static_assert(sizeof(GrammarLanguage) == 32, "GrammarLanguage must not have padding");
+
+}
+#endif // GRAMMARFORMAT_H
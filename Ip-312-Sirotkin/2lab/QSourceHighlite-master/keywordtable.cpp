@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "keywordtable.h"
+
+#include <QChar>
+#include <cstring>
+
+namespace QSourceHighlite {
+
+// FNV-1a, must match keywordHash() in tools/languagetablesgen
+static const quint64 hashOffset = Q_UINT64_C(14695981039346656037);
+static const quint64 hashPrime = Q_UINT64_C(1099511628211);
+
+WordClass KeywordTable::classify(const QChar *word, int length) const
+{
+    if (length <= 0 || length > maxLength)
+        return NoWord;
+
+    // keywords are plain ASCII, anything else can't match. Folding sets the
+    // lower case bit of A-Z without a branch, so that the hash and the
+    // memcmp below see the word as the generator stored it.
+    char buf[256];
+    const quint32 fold = foldCase == MatchCase ? 0 : 0x20;
+    quint64 h = hashOffset;
+    quint32 upper = 0;
+    for (int i = 0; i < length; ++i) {
+        const quint32 c = word[i].unicode();
+        if (c > 0x7f)
+            return NoWord;
+        const quint32 isUpper = quint32(c - 'A' < 26u);
+        const quint32 folded = c | (fold & (0u - isUpper));
+        buf[i] = static_cast<char>(folded);
+        h = (h ^ folded) * hashPrime;
+        upper |= isUpper;
+    }
+
+    if (foldCase == FoldKeywords && upper) {
+        // as listed the word may be any word, folded only a keyword
+        char exact[256];
+        quint64 exactHash = hashOffset;
+        for (int i = 0; i < length; ++i) {
+            exact[i] = static_cast<char>(word[i].unicode());
+            exactHash = (exactHash ^ quint32(word[i].unicode())) * hashPrime;
+        }
+        const WordClass wordClass = lookup(exactHash, exact, length);
+        if (wordClass != NoWord)
+            return wordClass;
+        return lookup(h, buf, length) == KeyWord ? KeyWord : NoWord;
+    }
+    return lookup(h, buf, length);
+}
+
+WordClass KeywordTable::lookup(quint64 h, const char *word, int length) const
+{
+    const quint32 lo = static_cast<quint32>(h);
+    const quint32 hi = static_cast<quint32>(h >> 32);
+    const quint32 d = displacements[lo & (bucketCount - 1)];
+    const KeywordSlot &slot = entries[(hi + d * (lo | 1)) & (entryCount - 1)];
+    if (slot.length != length ||
+        std::memcmp(pool + slot.offset, word, static_cast<size_t>(length)) != 0)
+        return NoWord;
+    return static_cast<WordClass>(slot.wordClass);
+}
+
+}
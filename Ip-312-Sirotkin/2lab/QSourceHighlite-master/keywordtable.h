@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef KEYWORDTABLE_H
+#define KEYWORDTABLE_H
+
+#include <QtGlobal>
+
+QT_BEGIN_NAMESPACE
+class QChar;
+QT_END_NAMESPACE
+
+namespace QSourceHighlite {
+
+/**
+ * @brief What a word of a language is
+ */
+enum WordClass : quint8 {
+    NoWord = 0,
+    TypeWord,
+    KeyWord,
+    LiteralWord,
+    BuiltInWord,
+    OtherWord
+};
+
+/**
+ * @brief A word of a KeywordTable, stored as a range of the table's pool
+ * @details An empty slot has a length of 0. All generated tables share one
+ * pool in which every word is stored once.
+ */
+struct KeywordSlot {
+    quint16 offset;
+    quint8 length;
+    quint8 wordClass;
+};
+
+/**
+ * @brief A read-only perfect hash map (power-of-two table) from the words
+ * of a language to their WordClass
+ * @details Tables are generated from languagedata.cpp by
+ * tools/languagetablesgen and are plain constant data, so they cost nothing
+ * at startup. A lookup is one hash of the word and one memcmp.
+ */
+struct KeywordTable {
+    const char *pool;
+    const KeywordSlot *entries;
+    const quint16 *displacements;
+    quint16 entryCount;
+    quint16 bucketCount;
+    quint8 maxLength;
+    // a CaseFolding
+    quint8 foldCase;
+
+    enum CaseFolding : quint8 {
+        MatchCase,
+        // words match in any ASCII case, as in SQL, and are stored in
+        // lower case
+        FoldWords,
+        // only keywords match in any case and are stored in lower case,
+        // other words match as listed, as in CMake
+        FoldKeywords
+    };
+
+    /**
+     * @brief returns the class of a word, NoWord if it isn't in the table
+     * @param word the first character of the word
+     * @param length the length of the word
+     */
+    Q_REQUIRED_RESULT WordClass classify(const QChar *word, int length) const;
+
+private:
+    Q_REQUIRED_RESULT WordClass lookup(quint64 h, const char *word, int length) const;
+};
+
+}
+#endif // KEYWORDTABLE_H
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "languageregistry.h"
+#include "languagetables.h"
+#include "grammarformat.h"
+
+#include <QAtomicPointer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QString>
+#include <QVector>
+
+#include <cstring>
+
+namespace QSourceHighlite {
+
+static const KeywordTable noKeywords = {};
+
+/**
+ * @brief Returns the data of a built-in language
+ * @details The data is constant and shared by all tokenizers.
+ */
+static const CompiledLanguage *builtInLanguage(QSourceHighliter::Language language)
+{
+    static const CompiledLanguage lua        = { &luaKeywords, 0, CompiledLanguage::LongBrackets, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage cpp        = { &cppKeywords, 0,
+                                                   CompiledLanguage::ContinuedStrings |
+                                                   CompiledLanguage::DigitQuotes,
+                                                   CompiledLanguage::CSuffixes };
+    static const CompiledLanguage c          = { &cppKeywords, 0, CompiledLanguage::ContinuedStrings, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage js         = { &jsKeywords, 0, CompiledLanguage::ContinuedStrings, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage bash       = { &shellKeywords, '#', 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage php        = { &phpKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage qml        = { &qmlKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage python     = { &pyKeywords, '#',
+                                                   CompiledLanguage::TripleQuotes |
+                                                   CompiledLanguage::ContinuedStrings,
+                                                   CompiledLanguage::PythonSuffixes };
+    static const CompiledLanguage rust       = { &rustKeywords, 0, CompiledLanguage::NestedComments,
+                                                   CompiledLanguage::RustSuffixes };
+    static const CompiledLanguage java       = { &javaKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage csharp     = { &csharpKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage go         = { &goKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage v          = { &vKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage sql        = { &sqlKeywords, 0,
+                                                   CompiledLanguage::IsSQL |
+                                                   CompiledLanguage::CaseInsensitive,
+                                                   CompiledLanguage::CSuffixes };
+    static const CompiledLanguage json       = { &jsonKeywords, 0, 0, CompiledLanguage::NoSuffixes };
+    static const CompiledLanguage xml        = { &noKeywords, 0, CompiledLanguage::IsXML, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage css        = { &cssKeywords, 0, CompiledLanguage::IsCSS,
+                                                   CompiledLanguage::CssUnits };
+    static const CompiledLanguage typescript = { &typescriptKeywords, 0, CompiledLanguage::ContinuedStrings, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage yaml       = { &yamlKeywords, '#', CompiledLanguage::IsYAML, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage ini        = { &noKeywords, '#', 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage vex        = { &vexKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage cmake      = { &cmakeKeywords, '#', CompiledLanguage::CaseInsensitiveKeywords, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage make       = { &makeKeywords, '#', CompiledLanguage::IsMake, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage assembly   = { &asmKeywords, '#',
+                                                   CompiledLanguage::IsAsm |
+                                                   CompiledLanguage::CaseInsensitive,
+                                                   CompiledLanguage::AsmSuffixes };
+    static const CompiledLanguage rhai       = { &rhaiKeywords, 0, 0, CompiledLanguage::CSuffixes };
+    static const CompiledLanguage none       = { &noKeywords, 0, 0, CompiledLanguage::CSuffixes };
+
+    switch (language) {
+        case QSourceHighliter::CodeLua :
+        case QSourceHighliter::CodeLuaComment :
+            return &lua;
+        case QSourceHighliter::CodeCpp :
+        case QSourceHighliter::CodeCppComment :
+            return &cpp;
+        case QSourceHighliter::CodeC :
+        case QSourceHighliter::CodeCComment :
+            return &c;
+        case QSourceHighliter::CodeJs :
+        case QSourceHighliter::CodeJsComment :
+            return &js;
+        case QSourceHighliter::CodeBash :
+            return &bash;
+        case QSourceHighliter::CodePHP :
+        case QSourceHighliter::CodePHPComment :
+            return &php;
+        case QSourceHighliter::CodeQML :
+        case QSourceHighliter::CodeQMLComment :
+            return &qml;
+        case QSourceHighliter::CodePython :
+            return &python;
+        case QSourceHighliter::CodeRust :
+        case QSourceHighliter::CodeRustComment :
+            return &rust;
+        case QSourceHighliter::CodeJava :
+        case QSourceHighliter::CodeJavaComment :
+            return &java;
+        case QSourceHighliter::CodeCSharp :
+        case QSourceHighliter::CodeCSharpComment :
+            return &csharp;
+        case QSourceHighliter::CodeGo :
+        case QSourceHighliter::CodeGoComment :
+            return &go;
+        case QSourceHighliter::CodeV :
+        case QSourceHighliter::CodeVComment :
+            return &v;
+        case QSourceHighliter::CodeSQL :
+            return &sql;
+        case QSourceHighliter::CodeJSON :
+            return &json;
+        case QSourceHighliter::CodeXML :
+            return &xml;
+        case QSourceHighliter::CodeCSS :
+        case QSourceHighliter::CodeCSSComment :
+            return &css;
+        case QSourceHighliter::CodeTypeScript:
+        case QSourceHighliter::CodeTypeScriptComment:
+            return &typescript;
+        case QSourceHighliter::CodeYAML:
+            return &yaml;
+        case QSourceHighliter::CodeINI:
+            return &ini;
+        case QSourceHighliter::CodeVex:
+        case QSourceHighliter::CodeVexComment:
+            return &vex;
+        case QSourceHighliter::CodeCMake:
+            return &cmake;
+        case QSourceHighliter::CodeMake:
+            return &make;
+        case QSourceHighliter::CodeAsm:
+            return &assembly;
+        case QSourceHighliter::CodeRhai :
+        case QSourceHighliter::CodeRhaiComment :
+            return &rhai;
+    }
+    return &none;
+}
+
+/**
+ * @brief The languages of one mapped grammar file
+ * @details Never freed, tokenizers keep pointers into it even after another
+ * file replaced its languages.
+ */
+struct LoadedGrammar {
+    QFile file;
+    QVector<KeywordTable> tables;
+    QVector<CompiledLanguage> languages;
+};
+
+// ids are even and fit the language byte of a block state
+static const int maxLanguageId = 0xff;
+
+// one slot per id, so reading never locks. Writers only store pointers to
+// languages that are complete and never freed.
+static QAtomicPointer<const CompiledLanguage> grammarLanguages[maxLanguageId / 2 + 1];
+// serializes loadGrammarFile()
+static QMutex grammarMutex;
+
+const CompiledLanguage *compiledLanguage(QSourceHighliter::Language language)
+{
+    if (uint(language) <= uint(maxLanguageId)) {
+        const CompiledLanguage *lang = grammarLanguages[language / 2].loadAcquire();
+        if (lang)
+            return lang;
+    }
+    return builtInLanguage(language);
+}
+
+static bool isPowerOfTwo(quint32 n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+static bool grammarError(QString *errorString, const QString &fileName, const char *reason)
+{
+    if (errorString)
+        *errorString = QStringLiteral("%1: %2").arg(fileName, QLatin1String(reason));
+    return false;
+}
+
+bool loadGrammarFile(const QString &fileName, QString *errorString)
+{
+#if Q_BYTE_ORDER != Q_LITTLE_ENDIAN
+    return grammarError(errorString, fileName, "grammar files need a little-endian CPU");
+#else
+    QScopedPointer<LoadedGrammar> grammar(new LoadedGrammar);
+    grammar->file.setFileName(fileName);
+    if (!grammar->file.open(QIODevice::ReadOnly)) {
+        if (errorString)
+            *errorString = grammar->file.errorString();
+        return false;
+    }
+
+    const qint64 size = grammar->file.size();
+    if (size < qint64(sizeof(GrammarHeader)) || size > 0x7fffffff)
+        return grammarError(errorString, fileName, "not a grammar file");
+    const uchar *data = grammar->file.map(0, size);
+    if (!data)
+        return grammarError(errorString, fileName, "can't be mapped");
+
+    GrammarHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, grammarMagic, sizeof(grammarMagic)) != 0)
+        return grammarError(errorString, fileName, "not a grammar file");
+    // older versions give fields another meaning, they are compiled again
+    if (header.version < grammarVersion)
+        return grammarError(errorString, fileName,
+                            "outdated grammar version, compile it again with grammarcompiler");
+    if (header.version != grammarVersion)
+        return grammarError(errorString, fileName, "unsupported grammar version");
+
+    // every range must lie inside the file, so that a broken file can't make
+    // the lexer read past the mapping
+    const quint64 fileSize = quint64(size);
+    const auto inFile = [fileSize](quint64 offset, quint64 length) {
+        return offset <= fileSize && length <= fileSize - offset;
+    };
+    if (header.fileSize != fileSize ||
+            header.languagesOffset % 4 != 0 ||
+            !inFile(header.languagesOffset, quint64(header.languageCount) * sizeof(GrammarLanguage)) ||
+            !inFile(header.poolOffset, header.poolSize) || header.poolSize > 0x10000)
+        return grammarError(errorString, fileName, "corrupt header");
+
+    const auto *records = reinterpret_cast<const GrammarLanguage *>(data + header.languagesOffset);
+    const char *pool = reinterpret_cast<const char *>(data + header.poolOffset);
+
+    grammar->tables.resize(header.languageCount);
+    grammar->languages.resize(header.languageCount);
+    for (int i = 0; i < header.languageCount; ++i) {
+        const GrammarLanguage &r = records[i];
+        if (r.id % 2 != 0 || r.id > maxLanguageId)
+            return grammarError(errorString, fileName, "language ids must be even and below 256");
+        if (quint64(r.nameOffset) + r.nameLength > header.poolSize)
+            return grammarError(errorString, fileName, "corrupt language name");
+        if (r.numberSuffixes > CompiledLanguage::AsmSuffixes)
+            return grammarError(errorString, fileName, "unknown number suffixes");
+
+        KeywordTable &table = grammar->tables[i];
+        table = KeywordTable();
+        if (r.entryCount != 0) {
+            if (!isPowerOfTwo(r.entryCount) || r.entryCount > 0xffff ||
+                    !isPowerOfTwo(r.bucketCount) ||
+                    r.entriesOffset % 4 != 0 || r.displacementsOffset % 2 != 0 ||
+                    !inFile(r.entriesOffset, quint64(r.entryCount) * sizeof(KeywordSlot)) ||
+                    !inFile(r.displacementsOffset, quint64(r.bucketCount) * sizeof(quint16)))
+                return grammarError(errorString, fileName, "corrupt keyword table");
+
+            const auto *entries = reinterpret_cast<const KeywordSlot *>(data + r.entriesOffset);
+            for (quint32 e = 0; e < r.entryCount; ++e) {
+                if (quint32(entries[e].offset) + entries[e].length > header.poolSize ||
+                        entries[e].length > r.maxLength || entries[e].wordClass > OtherWord)
+                    return grammarError(errorString, fileName, "corrupt keyword table");
+            }
+
+            table.pool = pool;
+            table.entries = entries;
+            table.displacements = reinterpret_cast<const quint16 *>(data + r.displacementsOffset);
+            table.entryCount = quint16(r.entryCount);
+            table.bucketCount = quint16(r.bucketCount);
+            table.maxLength = r.maxLength;
+            table.foldCase = (r.flags & CompiledLanguage::CaseInsensitive) ? KeywordTable::FoldWords :
+                             (r.flags & CompiledLanguage::CaseInsensitiveKeywords) ? KeywordTable::FoldKeywords :
+                                                                                     KeywordTable::MatchCase;
+        }
+
+        CompiledLanguage &lang = grammar->languages[i];
+        lang.keywords = &table;
+        lang.comment = char(r.lineComment);
+        lang.flags = int(r.flags);
+        lang.numberSuffixes = r.numberSuffixes;
+    }
+
+    QMutexLocker lock(&grammarMutex);
+    for (int i = 0; i < header.languageCount; ++i)
+        grammarLanguages[records[i].id / 2].storeRelease(&grammar->languages.at(i));
+    grammar.take();
+    return true;
+#endif
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef LANGUAGEREGISTRY_H
+#define LANGUAGEREGISTRY_H
+
+#include "qsourcehighliter.h"
+#include "keywordtable.h"
+
+QT_BEGIN_NAMESPACE
+class QString;
+QT_END_NAMESPACE
+
+namespace QSourceHighlite {
+
+/**
+ * @brief Everything highlightSyntax() needs to know about a language
+ * @details These are constant data pointing to the generated keyword tables
+ * in languagetables.cpp, or into a mapped grammar file, so resolving a
+ * language is a pointer assignment and nothing is built or copied while
+ * highlighting.
+ *
+ * The flags and NumberSuffixes are stored in grammar files, don't change
+ * their values.
+ */
+struct CompiledLanguage {
+    enum Flag {
+        IsCSS  = 0x01,
+        IsYAML = 0x02,
+        IsMake = 0x04,
+        IsAsm  = 0x08,
+        IsSQL  = 0x10,
+        IsXML  = 0x20,
+        // /* */ comments nest, as in Rust
+        NestedComments   = 0x40,
+        // """ and ''' strings, as in Python
+        TripleQuotes     = 0x80,
+        // -- comments and [[ ]] strings and comments, as in Lua
+        LongBrackets     = 0x100,
+        // a backslash at the end of a string continues it on the next line
+        ContinuedStrings = 0x200,
+        // words match in any case, see KeywordTable::foldCase
+        CaseInsensitive  = 0x400,
+        // only keywords match in any case, as CMake commands do
+        CaseInsensitiveKeywords = 0x800,
+        // ' separates digits, as in C++ 1'000, elsewhere it starts a literal
+        DigitQuotes      = 0x1000
+    };
+
+    // what may follow the digits of a number
+    enum NumberSuffixes : quint8 {
+        // 10UL, 1.0f, 2.5m, 10n
+        CSuffixes = 0,
+        NoSuffixes,
+        // 10u8, 1.5f32
+        RustSuffixes,
+        // 1j
+        PythonSuffixes,
+        // 10px, 1.5em
+        CssUnits,
+        // 0FFh, 1010b
+        AsmSuffixes
+    };
+
+    const KeywordTable *keywords;
+    char comment;
+    int flags;
+    quint8 numberSuffixes;
+};
+
+/**
+ * @brief Returns the shared, immutable data for a language
+ * @param language the language, or its comment state
+ * @details Languages from grammar files come first, so a grammar file can
+ * replace a built-in language. Unknown languages get no keywords.
+ *
+ * Safe to call from any thread, it doesn't lock. Built-in languages are
+ * constant data and loaded ones never change or go away, so the result can
+ * be used for as long as the caller likes.
+ */
+Q_REQUIRED_RESULT const CompiledLanguage *compiledLanguage(QSourceHighliter::Language language);
+
+/**
+ * @brief maps a grammar file compiled by tools/grammarcompiler and adds its
+ * languages
+ * @details The file stays mapped for the rest of the process, its keyword
+ * tables are used in place. It may be called while other threads
+ * highlight, they pick up the new languages the next time they resolve
+ * one. A tokenizer that already resolved a replaced language keeps the
+ * old one.
+ * @param errorString set to the reason if the file can't be loaded
+ * @return false if the file can't be read or isn't a valid grammar file
+ */
+bool loadGrammarFile(const QString &fileName, QString *errorString);
+
+}
+#endif // LANGUAGEREGISTRY_H
@@ -0,0 +1,2974 @@
+/*
+ * This file is generated by tools/languagetablesgen from languagedata.cpp.
+ * Do not edit it by hand, edit languagedata.cpp and rerun the generator.
+ */
+
+#include "languagetables.h"
+
+namespace QSourceHighlite {
+
+// the words of all languages, see KeywordSlot
+static const char wordPool[] =
+    "CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATIONCPACK_ERROR_ON_ABSOLUTE_INSTALL_DESTINATIONCMAKE_WARN"
+    "_ON_ABSOLUTE_INSTALL_DESTINATIONCPACK_COMPONENT_INCLUDE_TOPLEVEL_DIRECTORYCPACK_WARN_ON_ABSOLUTE"
+    "_INSTALL_DESTINATIONCMAKE_INCLUDE_DIRECTORIES_PROJECT_BEFORECMAKE_INCLUDE_CURRENT_DIR_IN_INTERFA"
+    "CECMAKE_VS_INTEL_Fortran_PROJECT_VERSIONCMAKE_INSTALL_DEFAULT_COMPONENT_NAMEIMPORTED_LINK_INTERF"
+    "ACE_MULTIPLICITYINTERFACE_SYSTEM_INCLUDE_DIRECTORIESCMAKE_EXTRA_SHARED_LIBRARY_SUFFIXESFIND_LIBR"
+    "ARY_USE_OPENBSD_VERSIONINGINTERFACE_POSITION_INDEPENDENT_CODEIMPLICIT_DEPENDS_INCLUDE_TRANSFORMT"
+    "ARGET_ARCHIVES_MAY_BE_SHARED_LIBSVS_DOTNET_TARGET_FRAMEWORK_VERSIONCMAKE_FIND_PACKAGE_WARN_NO_MO"
+    "DULECMAKE_FIND_ROOT_PATH_MODE_INCLUDECMAKE_FIND_ROOT_PATH_MODE_LIBRARYCMAKE_FIND_ROOT_PATH_MODE_"
+    "PACKAGECMAKE_FIND_ROOT_PATH_MODE_PROGRAMCMAKE_INSTALL_RPATH_USE_LINK_PATHCMAKE_SKIP_INSTALL_ALL_"
+    "DEPENDENCYIMPORTED_LINK_DEPENDENT_LIBRARIESIMPORTED_LINK_INTERFACE_LANGUAGESIMPORTED_LINK_INTERF"
+    "ACE_LIBRARIESCMAKE_ABSOLUTE_DESTINATION_FILESCMAKE_INCLUDE_DIRECTORIES_BEFORECMAKE_LIBRARY_ARCHI"
+    "TECTURE_REGEXCPACK_ABSOLUTE_DESTINATION_FILESCPACK_INCLUDE_TOPLEVEL_DIRECTORYCMAKE_POSITION_INDE"
+    "PENDENT_CODECMAKE_TRY_COMPILE_CONFIGURATIONCMAKE_VISIBILITY_INLINES_HIDDENCOMPATIBLE_INTERFACE_N"
+    "UMBER_MAXCOMPATIBLE_INTERFACE_NUMBER_MINALLOW_DUPLICATE_CUSTOM_TARGETSCMAKE_ARCHIVE_OUTPUT_DIREC"
+    "TORYCMAKE_BUILD_WITH_INSTALL_RPATHCMAKE_Fortran_MODULE_DIRECTORYCMAKE_LIBRARY_OUTPUT_DIRECTORYCM"
+    "AKE_LINK_INTERFACE_LIBRARIESCMAKE_MINIMUM_REQUIRED_VERSIONCMAKE_RUNTIME_OUTPUT_DIRECTORYCMAKE_US"
+    "ER_MAKE_RULES_OVERRIDECPACK_PACKAGING_INSTALL_PREFIXCMAKE_BACKWARDS_COMPATIBILITYCMAKE_DEBUG_TAR"
+    "GET_PROPERTIESCMAKE_NO_SYSTEM_FROM_IMPORTEDINTERFACE_COMPILE_DEFINITIONSINTERFACE_INCLUDE_DIRECT"
+    "ORIEScmake_host_system_informationCMAKE_FIND_NO_INSTALL_PREFIXCMAKE_Fortran_MODDIR_DEFAULTCMAKE_"
+    "LINK_DEPENDS_NO_SHAREDCMAKE_LINK_LIBRARY_FILE_FLAGCMAKE_NOT_USING_CONFIG_FLAGSCMAKE_XCODE_PLATFO"
+    "RM_TOOLSETFIND_LIBRARY_USE_LIB64_PATHSINTERPROCEDURAL_OPTIMIZATIONctest_empty_binary_directoryAD"
+    "DITIONAL_MAKE_CLEAN_FILESCMAKE_FIND_LIBRARY_PREFIXESCMAKE_FIND_LIBRARY_SUFFIXESCMAKE_HOST_SYSTEM"
+    "_PROCESSORCMAKE_IMPORT_LIBRARY_PREFIXCMAKE_IMPORT_LIBRARY_SUFFIXCMAKE_INTERNAL_PLATFORM_ABICMAKE"
+    "_OSX_DEPLOYMENT_TARGETCMAKE_SHARED_LIBRARY_PREFIXCMAKE_SHARED_LIBRARY_SUFFIXCMAKE_STATIC_LIBRARY"
+    "_PREFIXCMAKE_STATIC_LIBRARY_SUFFIXCOMPATIBLE_INTERFACE_STRINGMACOSX_FRAMEWORK_INFO_PLISTREPORT_U"
+    "NDEFINED_PROPERTIESTARGET_SUPPORTS_SHARED_LIBSexport_library_dependenciesset_source_files_proper"
+    "tiesCMAKE_AUTOMOC_RELAXED_MODECMAKE_PDB_OUTPUT_DIRECTORYCMAKE_SHARED_MODULE_PREFIXCMAKE_SHARED_M"
+    "ODULE_SUFFIXEXCLUDE_FROM_DEFAULT_BUILDINCLUDE_REGULAR_EXPRESSIONinclude_external_msprojectinclud"
+    "e_regular_expressionsample_circle_edge_uniformsample_hypersphere_uniformsample_lognormal_by_medi"
+    "ansample_orientation_uniformtarget_compile_definitionstarget_include_directoriesCMAKE_AUTOMOC_MO"
+    "C_OPTIONSCMAKE_CACHE_MAJOR_VERSIONCMAKE_CACHE_MINOR_VERSIONCMAKE_CACHE_PATCH_VERSIONCMAKE_CONFIG"
+    "URATION_TYPESCMAKE_Fortran_MODDIR_FLAGCMAKE_Fortran_MODOUT_FLAGCMAKE_HOST_SYSTEM_VERSIONCMAKE_LI"
+    "NK_LIBRARY_SUFFIXCMAKE_MODULE_LINKER_FLAGSCMAKE_SHARED_LINKER_FLAGSCMAKE_STATIC_LINKER_FLAGSCMAK"
+    "E_SYSTEM_INCLUDE_PATHCMAKE_SYSTEM_LIBRARY_PATHCMAKE_SYSTEM_PROGRAM_PATHCMAKE_VS_PLATFORM_TOOLSET"
+    "COMPATIBLE_INTERFACE_BOOLGLOBAL_DEPENDS_DEBUG_MODEINTERFACE_AUTOUIC_OPTIONSINTERFACE_COMPILE_OPT"
+    "IONSPREDEFINED_TARGETS_FOLDERCMAKE_CURRENT_BINARY_DIRCMAKE_CURRENT_SOURCE_DIRCMAKE_LINK_DEF_FILE"
+    "_FLAGCMAKE_NO_BUILTIN_CHRPATHCMAKE_SKIP_INSTALL_RPATHCMAKE_SKIP_INSTALL_RULESCMAKE_STANDARD_LIBR"
+    "ARIESCMAKE_SYSTEM_IGNORE_PATHCMAKE_SYSTEM_PREFIX_PATHCMAKE_USE_RELATIVE_PATHSCMAKE_VS_MSBUILD_CO"
+    "MMANDGLOBAL_DEPENDS_NO_CYCLESINTERFACE_LINK_LIBRARIESLINK_SEARCH_START_STATICMACOSX_BUNDLE_INFO_"
+    "PLISTget_source_file_propertysample_direction_uniformsensor_panorama_getcolorsensor_panorama_get"
+    "depthset_directory_propertiesCMAKE_CONFIGURE_DEPENDSCMAKE_CURRENT_LIST_FILECMAKE_CURRENT_LIST_LI"
+    "NECMAKE_EXECUTABLE_SUFFIXCMAKE_GENERATOR_TOOLSETCMAKE_LIBRARY_PATH_FLAGCMAKE_LINK_LIBRARY_FLAGCM"
+    "AKE_OSX_ARCHITECTURESCMAKE_VS_DEVENV_COMMANDFAIL_REGULAR_EXPRESSIONIMPORTED_CONFIGURATIONSMACOSX"
+    "_PACKAGE_LOCATIONPASS_REGULAR_EXPRESSIONVS_GLOBAL_PROJECT_TYPESVS_GLOBAL_ROOTNAMESPACEadd_compil"
+    "e_definitionsctest_read_custom_filessample_hypersphere_conesample_orientation_conesensor_panoram"
+    "a_getconesetagentlocaltransformssetagentworldtransformstarget_compile_featurestarget_link_direct"
+    "oriesunpack_intfromsafefloatATTACHED_FILES_ON_FAILAUTOGEN_TARGETS_FOLDERAUTOGEN_TARGET_DEPENDSAU"
+    "TOMOC_TARGETS_FOLDERCMAKE_CURRENT_LIST_DIRCMAKE_ERROR_DEPRECATEDCMAKE_EXE_LINKER_FLAGSCMAKE_HOST"
+    "_SYSTEM_NAMECMAKE_INSTALL_NAME_DIRCMAKE_JOB_POOL_COMPILECMAKE_PARENT_LIST_FILECMAKE_SCRIPT_MODE_"
+    "FILECMAKE_SKIP_BUILD_RPATHCMAKE_SYSTEM_PROCESSORCMAKE_VERBOSE_MAKEFILECMAKE_VS_MSDEV_COMMANDCMAK"
+    "E_WIN32_EXECUTABLEEXECUTABLE_OUTPUT_PATHLINK_SEARCH_END_STATICcmake_minimum_requiredcreate_test_"
+    "sourcelistget_directory_propertyget_filename_componentosd_limitsurfacevertexsensor_panorama_crea"
+    "tesetagentcollisionlayertarget_compile_optionsCMAKE_AUTORCC_OPTIONSCMAKE_AUTOUIC_OPTIONSCMAKE_EX"
+    "TRA_GENERATORCMAKE_OBJECT_PATH_MAXCMAKE_WARN_DEPRECATEDECLIPSE_EXTRA_NATURESPROJECT_VERSION_MAJO"
+    "RPROJECT_VERSION_MINORPROJECT_VERSION_PATCHPROJECT_VERSION_TWEAKagenttransformtolocalagenttransf"
+    "ormtoworldcmake_parse_argumentsfuzzy_defuzz_centroidoutput_required_filessample_circle_uniformsa"
+    "mple_direction_conesample_sphere_uniformset_target_propertiestarget_link_librariesversion_greate"
+    "r_equalCMAKE_APPBUNDLE_PATHCMAKE_COLOR_MAKEFILECMAKE_CROSSCOMPILINGCMAKE_FRAMEWORK_PATHCMAKE_For"
+    "tran_FORMATCMAKE_HOME_DIRECTORYCMAKE_INSTALL_PREFIXCMAKE_STAGING_PREFIXCMAKE_SYSTEM_VERSIONCMAKE"
+    "_TOOLCHAIN_FILECPACK_INSTALL_SCRIPTDEBUG_CONFIGURATIONSSTATIC_LIBRARY_FLAGSVS_DOTNET_REFERENCESa"
+    "gentclipsamplelocalagentclipsampleworldaux_source_directorydetailattribtypeinfohttp_response_hea"
+    "derset_tests_propertiessetagentcurrentlayervertexattribtypeinfoARCHIVE_OUTPUT_NAMECMAKE_CACHEFIL"
+    "E_DIRCMAKE_COMPILER_2005CMAKE_CTEST_COMMANDCMAKE_DEBUG_POSTFIXCMAKE_JOB_POOL_LINKCMAKE_MACOSX_BU"
+    "NDLECMAKE_MAJOR_VERSIONCMAKE_MINOR_VERSIONCMAKE_PATCH_VERSIONCMAKE_SIZEOF_VOID_PCMAKE_TWEAK_VERS"
+    "IONGENERATOR_FILE_NAMELIBRARY_OUTPUT_NAMELIBRARY_OUTPUT_PATHPOST_INSTALL_SCRIPTRULE_LAUNCH_COMPI"
+    "LERUNTIME_OUTPUT_NAMEVS_WINRT_EXTENSIONSVS_WINRT_REFERENCESadd_compile_optionsagentclipsamplerat"
+    "eagenttransformcountagenttransformnamescompfilescompgroupsget_target_propertyhedge_postdstvertex"
+    "pack_inttosafefloatpointattribtypeinfosample_circle_slicesetagentclipweightstarget_link_optionsC"
+    "MAKE_EDIT_COMMANDCMAKE_INCLUDE_PATHCMAKE_MACOSX_RPATHCMAKE_MAKE_PROGRAMCMAKE_PROGRAM_PATHCMAKE_P"
+    "ROJECT_NAMEHTTP_RAW_POST_DATAIMPORTED_NO_SONAMEPACKAGES_NOT_FOUNDPRE_INSTALL_SCRIPTPROJECT_BINAR"
+    "Y_DIRPROJECT_SOURCE_DIRRULE_LAUNCH_CUSTOMVS_SCC_PROJECTNAMEadd_custom_commandagentlayerbindingsd"
+    "ecodeURIComponentencodeURIComponentfindattribvalcountgeometrycollectionget_cmake_propertyhedge_p"
+    "ostdstpointhedge_presrcvertexlimit_sample_spaceprimattribtypeinforemove_definitionssample_expone"
+    "ntialsample_sphere_coneseparate_argumentsunordered_multimapunordered_multisetversion_less_equalB"
+    "UILD_SHARED_LIBSCMAKE_IGNORE_PATHCMAKE_MODULE_PATHCMAKE_OSX_SYSROOTCMAKE_PREFIX_PATHCMAKE_SYSTEM"
+    "_NAMECPACK_SET_DESTDIRDISABLED_FEATURESENABLED_LANGUAGESIMPORTED_LOCATIONTEST_INCLUDE_FILEUint8C"
+    "lampedArrayVS_GLOBAL_KEYWORDWORKING_DIRECTORYadd_custom_targeteulertoquaternionget_test_property"
+    "getglobalraylevelhedge_presrcpointmatchvex_specularsample_circle_arcsample_hemispheresetagentcli"
+    "pnamessetagentcliptimessetattribtypeinfovariable_requiresvolumeindexoriginBUNDLE_EXTENSIONCMAKE_"
+    "BINARY_DIRCMAKE_BUILD_TOOLCMAKE_BUILD_TYPECMAKE_CFG_INTDIRCMAKE_HOST_APPLECMAKE_HOST_WIN32CMAKE_"
+    "SKIP_RPATHCMAKE_SOURCE_DIRENABLED_FEATURESEXCLUDE_FROM_ALLHEADER_FILE_ONLYLINK_DIRECTORIESPARENT"
+    "_DIRECTORYRULE_LAUNCH_LINKSKIP_RETURN_CODEVS_SCC_LOCALPATHadd_dependenciesadd_link_optionsadd_su"
+    "bdirectoryagentclipcatalogagentclipchannelagentlayershapesagentrigchildrenctest_run_scriptdebug_"
+    "assert_eq!debug_assert_ne!detailattribsizeexpandpointgrouphedge_equivcounthenyeygreensteininitia"
+    "lizer_listinstall_programsintersect_lightsmark_as_advancednprimitivesgroupreinterpret_castresolv"
+    "emissedraysetprimintrinsicstorelightexportstrgreater_equaluse_mangled_mesavaeskeygenassistvertex"
+    "attribsizevolumeindextoposvolumepostoindexCACHE_VARIABLESCLEAN_NO_CUSTOMCMAKE_HOST_UNIXEXTERNAL_"
+    "OBJECTIMPORTED_IMPLIBIMPORTED_SONAMELINKER_LANGUAGEVS_SCC_PROVIDERadd_definitionsadddetailattrib"
+    "addvariablenameaddvertexattribagentcliplengthctest_configuredefine_propertydetailintrinsicenable"
+    "_languageexecute_processexpandprimgrouphasdetailattribhasvertexattribhedge_dstvertexhedge_isprim"
+    "aryhedge_nextequivhedge_srcvertexidentity_insertinstall_targetslocal_data_key!multilinestringpoi"
+    "ntattribsizeprimvertexcountqt5_use_modulesqt5_use_packageresample_linearsample_discretesample_ge"
+    "ometrysetcurrentlightsetdetailattribsetvertexattribunlimitunsetoptvbroadcastf32x4vbroadcastf64x4"
+    "vbroadcasti32x4vbroadcasti64x4vertexprimindexvpbroadcastmb2qvpbroadcastmw2dALIASED_TARGETCMAKE_M"
+    "FC_FLAGENABLE_EXPORTSIN_TRY_COMPILEKEEP_EXTENSIONLISTFILE_STACKOBJECT_DEPENDSOBJECT_OUTPUTSPACKA"
+    "GES_FOUNDPRIVATE_HEADERREQUIRED_FILESReferenceErrorVS_SCC_AUXPATHadd_executableaddpointattribage"
+    "ntrigparentassert_enabledauto_incrementconcat_idents!configure_filecracktransformctest_coveragec"
+    "test_memcheckenable_testingfilamentsamplegetphotonlightgetsamplestorehaspointattribhedge_dstpoin"
+    "thedge_srcpointhscript_snoisemake_directorymatchvex_blinnneighbourcountnverticesgroupopendatasou"
+    "rceosd_firstpatchosd_patchcountpcimportbyidx3pcimportbyidx4pcimportbyidxfpcimportbyidxipcimportb"
+    "yidxppcimportbyidxspcimportbyidxvpointhedgenextprim_attributeprimattribsizesetpointattribsetsamp"
+    "lestoresetvertexgroupsetvertexpointsmoothrotationsolvequadraticsubdir_dependstarget_sourcesuint_"
+    "least16_tuint_least32_tuint_least64_tunimplemented!utility_sourcevariable_watchvbroadcastf128vbr"
+    "oadcasti128vcmpfalse_oqpdvcmpfalse_oqpsvcmpfalse_oqsdvcmpfalse_oqssvcmpfalse_ospdvcmpfalse_ospsv"
+    "cmpfalse_ossdvcmpfalse_osssvfmaddsub123pdvfmaddsub123psvfmaddsub132pdvfmaddsub132psvfmaddsub213p"
+    "dvfmaddsub213psvfmaddsub231pdvfmaddsub231psvfmaddsub312pdvfmaddsub312psvfmaddsub321pdvfmaddsub32"
+    "1psvfmsubadd123pdvfmsubadd123psvfmsubadd132pdvfmsubadd132psvfmsubadd213pdvfmsubadd213psvfmsubadd"
+    "231pdvfmsubadd231psvfmsubadd312pdvfmsubadd312psvfmsubadd321pdvfmsubadd321psvolumegradientvscatte"
+    "rpf0dpdvscatterpf0dpsvscatterpf0qpdvscatterpf0qpsvscatterpf1dpdvscatterpf1dpsvscatterpf1qpdvscat"
+    "terpf1qpsCMAKE_COMMANDCMAKE_DL_LIBSCMAKE_GNUtoMSCMAKE_SYSROOTCMAKE_VERSIONCOMPILE_FLAGSDEFINE_SY"
+    "MBOLIMPORT_PREFIXIMPORT_SUFFIXInternalErrorPROJECT_LABELPUBLIC_HEADERRESOURCE_LOCKRULE_MESSAGESS"
+    "topIterationXCODE_VERSION__NAMESPACE__addprimattribaddvisualizerauthorizationbuild_commandcompar"
+    "gumentscomputenormalcontainstabledebug_assert!deterministicfreetexttablegetcomponentsgetlightsco"
+    "pegetobjectnamegetptextureidgetuvtangentshasprimattribhedge_isequivhedge_isvalidhedge_primaryhsc"
+    "ript_noisehscript_sturbinclude_guardinstall_filesintersect_allinvertexgroupis_newer_thanistrings"
+    "treamisuvrenderingmaketransformosd_facecountostringstreampcfind_radiuspointverticessample_cauchy"
+    "sample_normalsample_photonsetpointgroupsetprimattribsetprimvertexstatic_assertstrless_equaltet_f"
+    "aceindexuint_fast16_tuint_fast32_tuint_fast64_tuint_least8_tunordered_mapunordered_setvcmptrue_u"
+    "qpdvcmptrue_uqpsvcmptrue_uqsdvcmptrue_uqssvcmptrue_uspdvcmptrue_uspsvcmptrue_ussdvcmptrue_usssvc"
+    "mpunord_qpdvcmpunord_qpsvcmpunord_qsdvcmpunord_qssvcmpunord_spdvcmpunord_spsvcmpunord_ssdvcmpuno"
+    "rd_sssversion_equalvextractf32x4vextractf64x4vextracti32x4vextracti64x4vgatherpf0dpdvgatherpf0dp"
+    "svgatherpf0qpdvgatherpf0qpsvgatherpf1dpdvgatherpf1dpsvgatherpf1qpdvgatherpf1qpsvolumesamplevvpcl"
+    "mulhqhqdqvpclmulhqlqdqvpclmullqhqdqvpclmullqlqdqCMAKE_RANLIBFloat32ArrayFloat64ArrayMSVC_VERSION"
+    "WRAP_EXCLUDE__FUNCTION__addattributeagentaddclipagentrigfindcmake_policycompdescribectest_submit"
+    "ctest_updatectest_uploadcurlxnoise2dcurrent_datedynamic_castexec_programfiltershadowfind_library"
+    "find_packagefind_programfltk_wrap_uiformat_args!georectanglegetattributegetlightnamegetmetatable"
+    "getpointbboxgetrayweightgetuvobjectshscript_randhscript_turbinclude_bin!include_onceinclude_str!"
+    "inpointgroupis_directoryisraytracingisvalidindexload_commandmacro_rules!module_path!nbouncetypes"
+    "nonclusterednpointsgroupouterproductpcsampleleafphp_errormsgprimverticesqt5_wrap_cpprandom_fhash"
+    "random_ihashrandom_shashrandom_sobolreflectlightrefractlightrelativepathrelpointbboxrequire_once"
+    "sample_lightserializablesession_userset_propertysetmetatablesetprimgroupshadow_lightsource_group"
+    "specularBRDFstaticmethodsynchronizedtet_adjacenttexture3dBoxthread_localtransactionsuint_fast8_t"
+    "unreachable!vbroadcastsdvbroadcastssvcmpneq_oqpdvcmpneq_oqpsvcmpneq_oqsdvcmpneq_oqssvcmpneq_ospd"
+    "vcmpneq_ospsvcmpneq_ossdvcmpneq_osssvcmpneq_uqpdvcmpneq_uqpsvcmpneq_uqsdvcmpneq_uqssvcmpneq_uspd"
+    "vcmpneq_uspsvcmpneq_ussdvcmpneq_usssvcmpnge_uqpdvcmpnge_uqpsvcmpnge_uqsdvcmpnge_uqssvcmpnge_uspd"
+    "vcmpnge_uspsvcmpnge_ussdvcmpnge_usssvcmpngt_uqpdvcmpngt_uqpsvcmpngt_uqsdvcmpngt_uqssvcmpngt_uspd"
+    "vcmpngt_uspsvcmpngt_ussdvcmpngt_usssvcmpnle_uqpdvcmpnle_uqpsvcmpnle_uqsdvcmpnle_uqssvcmpnle_uspd"
+    "vcmpnle_uspsvcmpnle_ussdvcmpnle_usssvcmpnlt_uqpdvcmpnlt_uqpsvcmpnlt_uqsdvcmpnlt_uqssvcmpnlt_uspd"
+    "vcmpnlt_uspsvcmpnlt_ussdvcmpnlt_usssvelocitynamevextractf128vextracti128vfnmadd123pdvfnmadd123ps"
+    "vfnmadd123sdvfnmadd123ssvfnmadd132pdvfnmadd132psvfnmadd132sdvfnmadd132ssvfnmadd213pdvfnmadd213ps"
+    "vfnmadd213sdvfnmadd213ssvfnmadd231pdvfnmadd231psvfnmadd231sdvfnmadd231ssvfnmadd312pdvfnmadd312ps"
+    "vfnmadd312sdvfnmadd312ssvfnmadd321pdvfnmadd321psvfnmadd321sdvfnmadd321ssvfnmsub123pdvfnmsub123ps"
+    "vfnmsub123sdvfnmsub123ssvfnmsub132pdvfnmsub132psvfnmsub132sdvfnmsub132ssvfnmsub213pdvfnmsub213ps"
+    "vfnmsub213sdvfnmsub213ssvfnmsub231pdvfnmsub231psvfnmsub231sdvfnmsub231ssvfnmsub312pdvfnmsub312ps"
+    "vfnmsub312sdvfnmsub312ssvfnmsub321pdvfnmsub321psvfnmsub321sdvfnmsub321ssvinsertf32x4vinsertf64x4"
+    "vinserti32x4vinserti64x4volumeindexvvpbroadcastbvpbroadcastdvpbroadcastqvpbroadcastwArrayBufferC"
+    "MAKE_ARGV0CMAKE_CL_64ENVIRONMENTEXPORT_NAMEMEASUREMENTSyntaxErrorUSE_FOLDERSUint16ArrayUint32Arr"
+    "ayaccessframeadd_libraryattribclassbouncelabelclassmethodctest_buildctest_sleepctest_startcurlno"
+    "ise2ddeterminantdiffuseBRDFdistinctrowdistributedeigenvaluesendfunctionenumerationenvironmentexp"
+    "and_udimfallthroughgetmaterialgetraylevelgetregistryilluminanceinprimgroupinterpolateiplaneindex"
+    "is_absoluteisconnectedisshadowraynametopointnormal_bsdfoption_env!optransformosd_patchesperspect"
+    "ivepointvertexpolardecompprefetchntaprefetchwt1prim_normalpunctuationqt_wrap_cpprawbumpmapArawbu"
+    "mpmapBrawbumpmapGrawbumpmapLrawbumpmapRrawcolormapreconfigureremovegroupremoveindexremovepointre"
+    "movevaluerenderstatereplicationrotate_x_tosample_bsdfsensor_savesha256rnds2static_castsystem_use"
+    "rtranslucenttry_compileuncommittedunserializevaesdeclastvaesenclastvcmpeq_ospdvcmpeq_ospsvcmpeq_"
+    "ossdvcmpeq_osssvcmpeq_uqpdvcmpeq_uqpsvcmpeq_uqsdvcmpeq_uqssvcmpeq_uspdvcmpeq_uspsvcmpeq_ussdvcmp"
+    "eq_usssvcmpfalsepdvcmpfalsepsvcmpfalsesdvcmpfalsessvcmpge_oqpdvcmpge_oqpsvcmpge_oqsdvcmpge_oqssv"
+    "cmpge_ospdvcmpge_ospsvcmpge_ossdvcmpge_osssvcmpgt_oqpdvcmpgt_oqpsvcmpgt_oqsdvcmpgt_oqssvcmpgt_os"
+    "pdvcmpgt_ospsvcmpgt_ossdvcmpgt_osssvcmple_oqpdvcmple_oqpsvcmple_oqsdvcmple_oqssvcmple_ospdvcmple"
+    "_ospsvcmple_ossdvcmple_osssvcmplt_oqpdvcmplt_oqpsvcmplt_oqsdvcmplt_oqssvcmplt_ospdvcmplt_ospsvcm"
+    "plt_ossdvcmplt_osssvcmpord_qpdvcmpord_qpsvcmpord_qsdvcmpord_qssvcmpord_spdvcmpord_spsvcmpord_ssd"
+    "vcmpord_sssvcmpunordpdvcmpunordpsvcmpunordsdvcmpunordssvcompresspdvcompresspsvcvttpd2udqvcvttps2"
+    "udqvcvttsd2usivcvttss2usivertexindexvfixupimmpdvfixupimmpsvfixupimmsdvfixupimmssvfmadd123pdvfmad"
+    "d123psvfmadd123sdvfmadd123ssvfmadd132pdvfmadd132psvfmadd132sdvfmadd132ssvfmadd213pdvfmadd213psvf"
+    "madd213sdvfmadd213ssvfmadd231pdvfmadd231psvfmadd231sdvfmadd231ssvfmadd312pdvfmadd312psvfmadd312s"
+    "dvfmadd312ssvfmadd321pdvfmadd321psvfmadd321sdvfmadd321ssvfmaddsubpdvfmaddsubpsvfmsub123pdvfmsub1"
+    "23psvfmsub123sdvfmsub123ssvfmsub132pdvfmsub132psvfmsub132sdvfmsub132ssvfmsub213pdvfmsub213psvfms"
+    "ub213sdvfmsub213ssvfmsub231pdvfmsub231psvfmsub231sdvfmsub231ssvfmsub312pdvfmsub312psvfmsub312sdv"
+    "fmsub312ssvfmsub321pdvfmsub321psvfmsub321sdvfmsub321ssvfmsubaddpdvfmsubaddpsvinsertf128vinserti1"
+    "28vmaskmovdquvpcompressdvpcompressqvpconflictdvpconflictqvphminposuwvpscatterddvpscatterdqvpscat"
+    "terqdvpscatterqqvpunpckhqdqvpunpcklqdqvrndscalepdvrndscalepsvrndscalesdvrndscalessvscatterdpdvsc"
+    "atterdpsvscatterqpdvscatterqpswirediffusezregexparseCMAKE_ARGCCMAKE_ROOTEchoStringHELPSTRINGInt1"
+    "6ArrayInt32ArrayLINK_FLAGSPROCESSORSRUN_SERIALRangeErrorUint8ArrayVS_KEYWORD__METHOD____import__"
+    "__newindex__tostring_timestampalternatesattachmentbackgroundbasestringberkeleydbbouncemaskbuild_"
+    "namecheckpointcmpxchg16bcmpxchg486complex128compvaluesconsistentconst_castconstraintcoordinatect"
+    "est_testctransformdeallocatedecorationdelimitersdescendingenddeclareendforeachfastshadowfillfact"
+    "orfilterstepfindstringflowpnoisefuzzy_nandfuzzy_nxorgetbouncesgetfognamegetlightidgetsmoothPgetu"
+    "pvaluehedge_previmplementsinstanceofinumplanesiplanenameiplanesizeirradianceis_def_varis_symlink"
+    "isinstanceissubclassistarttimeload_cacheloadall286loadstringmediumblobmemoryviewmetaimportmetawe"
+    "ightnametoprimnearpointsneighboursnewsamplernextsamplenormalnamentransformnuniquevalopfullpathop"
+    "tionallyparseFloatpcfarthestpcgeneratepcnumfoundpcunshadedpointprimsprefetcht0prefetcht1prefetch"
+    "t2primpointsprint_onceprintfreadprintpushdprivilegesqt_wrap_uirayhittestre_findallre_replacerefe"
+    "rencesremoveprimrepeatablesampledisksetupvaluesha256msg1sha256msg2shared_ptrslideframesolvecubic"
+    "stackallocstartswithstatisticsstringify!tablespaceterminatedtransitiontransitiveunfunctionunique"
+    "_ptrupdatetextvcmptruepdvcmptruepsvcmptruesdvcmptruessvcvtpd2udqvcvtps2udqvcvtsd2usivcvtss2usivc"
+    "vttpd2dqvcvttps2dqvcvttsd2sivcvttss2sivcvtudq2pdvcvtudq2psvcvtusi2sdvcvtusi2ssvertexnextvertexpr"
+    "evvextractpsvgatherdpdvgatherdpsvgatherqpdvgatherqpsvgetmantpdvgetmantpsvgetmantsdvgetmantssvisi"
+    "bilityvmaskmovpdvmaskmovpsvpclmulqdqvpcmpestrivpcmpestrmvpcmpistrivpcmpistrmvpcmpnequdvpcmpnequq"
+    "vpcmpnleudvpcmpnleuqvpcmpnltudvpcmpnltuqvperm2f128vperm2i128vpgatherddvpgatherdqvpgatherqdvpgath"
+    "erqqvpmacssdqhvpmacssdqlvpmadcsswdvpmaddubswvpmaskmovdvpmaskmovqvpternlogdvpternlogqvpunpckhbwvp"
+    "unpckhdqvpunpckhwdvpunpcklbwvpunpckldqvpunpcklwdvrsqrt14pdvrsqrt14psvrsqrt14sdvrsqrt14ssvrsqrt28"
+    "pdvrsqrt28psvrsqrt28sdvrsqrt28ssvshuff32x4vshuff64x2vshufi32x4vshufi64x2vtransformvzeroupperwrit"
+    "e_filewritepixelxsaveopt64zparseoptsEvalErrorGENERATEDInt8ArrayJOB_POOLSMouseAreaQOwnNotesRectan"
+    "gleSOVERSIONTextInputTypeErrorWILL_FAIL__CLASS____contactaddsuffixalgorithmalphanameanimationasc"
+    "endingashikhminbb0_resetbb1_resetbitflags!blackbodyblinnBRDFbytearraycharacterchnumchancmpxchg8b"
+    "co_returncolornamecomplex64compquoteconstevalconstexprconstinitcpu_writecvex_bsdfcvttpd2picvttps"
+    "2pidatabasesdepthnamedistance2duplicateelevationemulatefcendregionendswitchenumerateeval_bsdfexc"
+    "eptionfile_statfind_filefind_pathfirstwordflownoisefollowingforpointsfrontfacefrozensetfunctions"
+    "fuzzy_andfuzzy_norfuzzy_notfuzzy_xorfxrstor64geocirclegetboundsgetprimidhasattribidtopointihaspl"
+    "aneimaginaryimportantinsteadofinterfaceis_def_fnis_sharedisolationisotropicissamplesissecondsisv"
+    "aryingiterationleftimageligaturesmakebasismatrix4x4metamarchmetastartmiddleintmodifiersnamespace"
+    "normalizeocclusionow_nspaceow_vspacepartitionpathtracepciteratepcopenlodphongBRDFphonglobephoton"
+    "mappluralizepointedgepointnameprecedingprecisionprimhedgeprocedureprotectedqdistanceqmultiplyqow"
+    "nnotesraiserrorraw_inputrayimportreadarraysavepointsha1nextesha1rnds4shadowmapsite_namesnapcraft"
+    "solvepolysplitpathsynthesistemporaryteximporttexprintftimestraptitlecasetracebacktransienttransl"
+    "atetransposetw_nspacetw_vspaceuintmax_tuintptr_tunboundeduncheckedundefinedunderlinevaddsubpdvad"
+    "dsubpsvarbinaryvblendmpdvblendmpsvblendvpdvblendvpsvcmpneqpdvcmpneqpsvcmpneqsdvcmpneqssvcmpngepd"
+    "vcmpngepsvcmpngesdvcmpngessvcmpngtpdvcmpngtpsvcmpngtsdvcmpngtssvcmpnlepdvcmpnlepsvcmpnlesdvcmpnl"
+    "essvcmpnltpdvcmpnltpsvcmpnltsdvcmpnltssvcmpordpdvcmpordpsvcmpordsdvcmpordssvcvtdq2pdvcvtdq2psvcv"
+    "tpd2dqvcvtpd2psvcvtph2psvcvtps2dqvcvtps2pdvcvtps2phvcvtsd2sivcvtsd2ssvcvtsi2sdvcvtsi2ssvcvtss2sd"
+    "vcvtss2sivexpandpdvexpandpsvfnmaddpdvfnmaddpsvfnmaddsdvfnmaddssvfnmsubpdvfnmsubpsvfnmsubsdvfnmsu"
+    "bssvgetexppdvgetexppsvgetexpsdvgetexpssvinsertpsvmovdqa32vmovdqa64vmovdqu32vmovdqu64vmovmskpdvmo"
+    "vmskpsvmovntdqavmovshdupvmovsldupvolumeresvpackssdwvpacksswbvpackusdwvpackuswbvpblendmdvpblendmq"
+    "vpblendvbvpcmpequdvpcmpequqvpcmpleudvpcmpleuqvpcmpltudvpcmpltuqvpcmpneqdvpcmpneqqvpcmpnledvpcmpn"
+    "leqvpcmpnltdvpcmpnltqvpermi2pdvpermi2psvpermilpdvpermilpsvpermt2pdvpermt2psvpexpanddvpexpandqvph"
+    "addubdvphaddubqvphaddubwvphaddudqvphadduwdvphadduwqvpmacsdqhvpmacsdqlvpmacssddvpmacsswdvpmacssww"
+    "vpmadcswdvpmovmskbvpmovsxbdvpmovsxbqvpmovsxbwvpmovsxdqvpmovsxwdvpmovsxwqvpmovusdbvpmovusdwvpmovu"
+    "sqbvpmovusqdvpmovusqwvpmovzxbdvpmovzxbqvpmovzxbwvpmovzxdqvpmovzxwdvpmovzxwqvpmulhrswvptestnmdvpt"
+    "estnmqvscalefpdvscalefpsvscalefsdvscalefssvunpckhpdvunpckhpsvunpcklpdvunpcklpswireblinnwo_nspace"
+    "wo_vspacewritetextwt_nspacewt_vspacexcryptcbcxcryptcfbxcryptctrxcryptecbxcryptofbABSTRACTADVANCE"
+    "DBehaviorDataViewFunctionInfinityListViewMODIFIEDMSVC_IDEPDB_NAMEPROPERTYSYMBOLICURIError__FILE_"
+    "___LINE__abstractadd_testaddgroupauto_ptrautoloadbackfacebasenamebumpnamecallablecascadedchar16_"
+    "tchar32_tchstartfchstarttcksplineco_awaitco_yieldcoalescecollapsecompcallcomptagscontinuecpu_rea"
+    "dcvtpd2picvtpi2pdcvtpi2pscvtps2pidatetimedebuggerdecltypedelegatedepthmapdihedraldocumentdsmpixe"
+    "ldumpfiledurationenclosedendmacroendswithendwhileexecfileexplicitextendedfcmovnbefuzzy_orfxsave6"
+    "4geoshapegetblurPgetderivgetlocalgetscopegetspacehaslighthint_nopholdlockhsvtorgbidtoprimiendtim"
+    "eimplicitinternalintervalisFiniteisfiniteisfograyisframesisxdigitkortestwkshiftlwkshiftrwkunpckb"
+    "wlastwordlksplineloadfilelongblobmasknamemdensitymetanextmodifiesnationalnewgroupnoexceptnonloca"
+    "loffsetofopdigitsoperatoroptimizeoverflowoverrideow_spaceparseIntpatsubstpcconvexpcexportpcfilte"
+    "rpfrcpit1pfrcpit2pfrsqit1pfrsqrtvpmachriwpmulhriwpmulhrwapmulhrwcpositionprintln!providesqconver"
+    "trawequalrdfsbaserdgsbasere_matchre_splitreadonlyrealpathregisterresignalrestrictreversedrgbtohs"
+    "vrgbtoxyzrichnessrollbackrowcountsetlocalsettingssha1msg1sha1msg2shimportshutdownsincludesmallin"
+    "tsmintoldsnapshotsnprintfstartingstrequalstrictfpsysentertemplatetextsizetinyblobtonumbertruncat"
+    "etw_spacetypenameuint16_tuint32_tuint64_tunescapeunexportunsigneduvunwrapvariancevblendpdvblendp"
+    "svcmpeqpdvcmpeqpsvcmpeqsdvcmpeqssvcmpgepdvcmpgepsvcmpgesdvcmpgessvcmpgtpdvcmpgtpsvcmpgtsdvcmpgts"
+    "svcmplepdvcmplepsvcmplesdvcmplessvcmpltpdvcmpltpsvcmpltsdvcmpltssvector2dvector3dvector4dvertica"
+    "lvfmaddpdvfmaddpsvfmaddsdvfmaddssvfmsubpdvfmsubpsvfmsubsdvfmsubssvfprintfvldmxcsrvmlaunchvmovddu"
+    "pvmovhlpsvmovlhpsvmovntpdvmovntpsvmovntqqvmpsadbwvmresumevolatilevpaddusbvpadduswvpalignrvpblend"
+    "dvpblendwvpcmpeqbvpcmpeqdvpcmpeqqvpcmpeqwvpcmpgtbvpcmpgtdvpcmpgtqvpcmpgtwvpcmpledvpcmpleqvpcmplt"
+    "dvpcmpltqvpermi2dvpermi2qvpermt2dvpermt2qvphaddbdvphaddbqvphaddbwvphadddqvphaddswvphaddwdvphaddw"
+    "qvphsubbwvphsubdqvphsubswvphsubwdvplzcntdvplzcntqvpmacsddvpmacswdvpmacswwvpmaddwdvpmovsdbvpmovsd"
+    "wvpmovsqbvpmovsqdvpmovsqwvpmulhuwvpmuludqvpshufhwvpshuflwvpsubusbvpsubuswvptestmdvptestmqvrcp14p"
+    "dvrcp14psvrcp14sdvrcp14ssvrcp28pdvrcp28psvrcp28sdvrcp28ssvroundpdvroundpsvroundsdvroundssvrsqrtp"
+    "svrsqrtssvsprintfvstmxcsrvucomisdvucomissvzeroallwarningswildcardwo_spacewrfsbasewrgsbasewriteln"
+    "!wt_spacexreleasexyztorgbzcompilezmodloadBORLANDBooleanGLOBALSHAS_CXXPromiseQStringQVectorREQUES"
+    "TReflectSESSIONSOURCESSTRINGSTIMEOUTWeakMapWeakSet_Pragma__DIR____indexabspathalignasalignofambi"
+    "entanalyzeargsortazimuthbalancebindkeybit_andblcfillblsfillbooleanbuiltinbyteptrcaptionchar8_tch"
+    "inputclflushcmovnaecmovngecmovnlecollatecolumnscommentcompctlcomptryconcat!conceptconsolecontent"
+    "countercsplinedecimaldefaultdefinerdegreesdelattrdelayeddimportdisablediscarddisplayerf_invescap"
+    "edexplainextendsfcmovbefcmovnefcmovnufdecstpfinallyfincstpflatpakfloat32float64fnstenvforeignfor"
+    "mat!fresnelfrndintfromNDCfsincosfucomipfucomppfuzzifyfxtractfyl2xp1geoselfgetbboxgetfenvgethookg"
+    "etinfogetoptsglobalsguidcolhandlerhanginghistoryhyphensiaspectichnameifn?defin_listingroupinsert"
+    "qintegerinvlpgainvokerinvpcidinvvpidisalnumisalphaisboundiscntrlisdigitisgraphislowerisprintispu"
+    "nctisspaceisupperjustifykerningkillalllength2limportlsplinelumnamemapfilematchedmatchesmatrix2ma"
+    "trix3messagemonitormontmulmovdq2qmovntsdmovntssmovq2dqmutablenaturalnosplitnrandomnullptrnumeral"
+    "numericoffsetsopacityopensslopstartorderbyorphansoutlinepaddingpaddsiwpartialpavgusbpcclosepcwri"
+    "tepdistibpercentpfcmpeqpfcmpgepfcmpgtpfpnaccpmvgezbpolygonprepareprivatepsubsiwptlinedputcharqin"
+    "vertqrotateradiansreallocrecoverrelbboxreorderrestorereturnsroutinesectionselect!setcompsetcsets"
+    "etfenvsethooksetusersimportspacingssize_tstrcspnstretchstripedstrncatstrncmpstrncpystrpbrkstrrch"
+    "rsubdirssuspendswizzlesyscallsysexittolowertouppertriggertry_runtsequaltype_oftypedeftypesetuint"
+    "8_tunaliasunicodeunpivotunsizedvaesimcvaligndvalignqvandnpdvandnpsvariantvcomisdvcomissvexp2pdve"
+    "xp2psvfrczpdvfrczpsvfrczsdvfrczssvhaddpdvhaddpsvhsubpdvhsubpsvirtualvmclearvmmcallvmovapdvmovaps"
+    "vmovhpdvmovhpsvmovlpdvmovlpsvmovqqavmovqquvmovupdvmovupsvmptrldvmptrstvmwritevoidptrvpaddsbvpadd"
+    "swvpandndvpandnqvpcmpudvpcmpuqvpcomubvpcomudvpcomuqvpcomuwvpermpdvpermpsvpextrbvpextrdvpextrqvpe"
+    "xtrwvpinsrbvpinsrdvpinsrqvpinsrwvpmaxsbvpmaxsdvpmaxsqvpmaxswvpmaxubvpmaxudvpmaxuqvpmaxuwvpminsbv"
+    "pminsdvpminsqvpminswvpminubvpminudvpminuqvpminuwvpmovdbvpmovdwvpmovqbvpmovqdvpmovqwvpmuldqvpmulh"
+    "wvpmulldvpmullwvprintfvprolvdvprolvqvprorvdvprorvqvpsadbwvpshufbvpshufdvpsignbvpsigndvpsignwvpsl"
+    "ldqvpsllvdvpsllvqvpsravdvpsravqvpsrldqvpsrlvdvpsrlvqvpsubsbvpsubswvshufpdvshufpsvsqrtpdvsqrtpsvs"
+    "qrtsdvsqrtssvtestpdvtestpswaitforwchar_twstringxaquirexnoisedxsha256xyzdistzformatzsocketButtonC"
+    "FLAGSCOOKIECYGWINLABELSMACROSMSVC10MSVC11MSVC12MSVC60MSVC70MSVC71MSVC80MSVC90NumberObjectOptionR"
+    "egExpResultSERVERSymbol__calladjustalbedoand_eqanoiseappendassignbackupbeforebigintbinputbit_orb"
+    "itsetblcmskblsmskbndldxbndmovbndstxborderbottombrowsebufferbytes!callercallocchangechendfchendtc"
+    "hrampchratechsrawcinputcmovaecmovgecmovlecmovnccmovnocmovnpcmovnscmovnzcmovpecmovpocoercecursord"
+    "eletedisowndivmoddockerdofiledoubleduringechotcechotielseifengineerrlvlerrorsexistsfamilyfcmovef"
+    "cmovufcomipfcomppfdivrpffreepficompfidivrfieldsfinputfisttpfisubrflavorfldenvfldl2efldl2tfldlg2f"
+    "ldln2fnclexfndisifninitfnsavefnstcwfnstswfpatanfprem1friendfrstorfscalefscanffsetpmfstenvfsubrpf"
+    "uturegetcapgetsechavingheightifn?eqifndefignoreincbinindentinfileinlineinnodbinsideinveptipairsk"
+    "andnwkxnorwlambdalayoutletterlfencelinenollwpcblogoutlookatloopneloopnzlstriplwpinslwpvalmallocm"
+    "arginmarkermemchrmemcmpmemcpymemsetmfenceminutemkswapmodifymovntimspacenativeninputnoglobnot_eqn"
+    "otdirnullifonoiseoutsetpacmanpanic!paramspcsizepfnaccpfrcpvpfsubrpgfindpmvlzbpmvnzbpopcntpragmap"
+    "rimuvprint!pshufwpswapdpublicpushadpushawpushfdpushfqpushfwpushlnpythonquotesranlibrawgetrawsetr"
+    "drandrdseedrdtscpreducerehashreloadrenameresizerevokerolluprowsetrstripschemasealedsetcapsetnaes"
+    "etnbesetngesetnlesfenceshrinksimplesizeofsizingskinitslwpcbsonamesortedspeechsscanfstatusstderrs"
+    "tdoutstrcatstrchrstrcmpstrcpystressstrlenstrspnstrstrstructswapgssysrett1mskcthrowstimingttyctlt"
+    "ypeidtypeofulimitunhashunichrunlockunsafeushortvaddpdvaddpsvaddsdvaddssvandpdvandpsvcmppdvcmppsv"
+    "cmpsdvcmpssvdivpdvdivpsvdivsdvdivssvlddquvldqquvmaxpdvmaxpsvmaxsdvmaxssvmcallvmfuncvminpdvminpsv"
+    "minsdvminssvmloadvmovsdvmovssvmreadvmsavevmulpdvmulpsvmulsdvmulssvmxoffvnoisevpabsbvpabsdvpabsqv"
+    "pabswvpaddbvpadddvpaddqvpaddwvpanddvpandqvpavgbvpavgwvpcmovvpcmpdvpcmpqvpcombvpcomdvpcomqvpcomwv"
+    "permdvpermqvppermvproldvprolqvprordvprorqvprotbvprotdvprotqvprotwvpshabvpshadvpshaqvpshawvpshlbv"
+    "pshldvpshlqvpshlwvpsllqvpsllwvpsradvpsraqvpsrawvpsrlqvpsrlwvpsubbvpsubdvpsubqvpsubwvpxordvpxorqv"
+    "rcppsvrcpssvsubpdvsubpsvsubsdvsubssvxorpdvxorpswbinvdwhencewidowswindowwrite!xabortxbeginxgetbvx"
+    "or_eqxrangexsetbvxstoreyaourtzstyleFALSEFalseProxyQHashQListVALUE__div__mod__mul__sub__unmaftera"
+    "pplyareasasciiasianasyncatan2attenbextrblcicbleedblsicbndclbndcnbndcubndmkbreakbswapbtreecaretca"
+    "tchcellschainchdirclampclonecmovccmovocmovscmovzcmpsbcmpsqcmpswcpuidcratecrc32crosscurrycycledef"
+    "erdequedmintdummydwordendefendifeventf2xm1faddpfbstpfclexfdisifdiskfdivpfemmsfiaddfile!fimulfist"
+    "pfit01fit10fit11fixedfldcwfldpifloorfmulpfneniforcefptanfputsfrexpfsavefsqrtfstcwfstswfsubpfwait"
+    "getlngloblgrantguileicebpidivlidivqifdefimullimulqinnerinoutint01int03irateiretdiretqiretwisNaNi"
+    "sizeisnanissetitemsixresiyresjecxzjrcxzkandwkmovwknotwkxorwlcaseldexpleaveline!lodsblodsdlodsqlo"
+    "dswlog10loopeloopzmarksmergemkdirmonthmountmovsbmovswmwaitnmclinobndoutsboutsdoutswpamacpausepav"
+    "ebpf2idpf2iwpfaccpfaddpfmaxpfminpfmulpi2fdpi2fwpitchpmagwpmvzbpopadpopawpopfdpopfqpopfwpurgepush"
+    "qqueryqueuequickqwordrdmsrrdpmcrdshrreadsrepnerepnzresdqrightrsldtrtreesbytescasbscasdscasqscasw"
+    "schedserifsetaesetbesetgesetlesetncsetnesetnosetnpsetnssetnzsetpeshellshllqshoptslerpspawnspeaks"
+    "tdinstosbstosdstosqstoswsupersvldttestltestqtoNDCtraittupletzcnttzmskucaseulongumaskunionuntilup"
+    "ushusageusingusizevaredvdppdvdppsvmrunvmxonvoicevorpdvorpsvpathvpordvporqwherewhichwhitewidthwrm"
+    "srwrshrxlatbxmm10xmm11xmm12xmm13xmm14xmm15xmm16xmm17xmm18xmm19xmm20xmm21xmm22xmm23xmm24xmm25xmm2"
+    "6xmm27xmm28xmm29xmm30xmm31xsha1xtestymm10ymm11ymm12ymm13ymm14ymm15ymm16ymm17ymm18ymm19ymm20ymm21"
+    "ymm22ymm23ymm24ymm25ymm26ymm27ymm28ymm29ymm30ymm31zmm10zmm11zmm12zmm13zmm14zmm15zmm16zmm17zmm18z"
+    "mm19zmm20zmm21zmm22zmm23zmm24zmm25zmm26zmm27zmm28zmm29zmm30zmm31zprofBashCOSTDateIntlItemJSONMat"
+    "hNULLNoneQMapSelfTRUETrue__eq__le__ltacosadcxaddladoxargcargvarplasinatofatoibidiblcsblsrbnd0bnd"
+    "1bnd2bnd3bulkbzhicbrtcdqeceilcerrcfg!clacclgiclogcltdcltscol!copycoshcoutcwdedbccdenydictdonedro"
+    "pelifendlerfcesacfabsfbldfcosfenifildfld1fldzflexfmodfnopfontfsckfstpftstfxamfxchgotogridgrowhai"
+    "rhelphouribtsiotaitoajcxzjmpejnaejnbejngejnlejobsjoinkeyskorwlabslahflealleaqlgdtlidtlldtlmswmai"
+    "nmathmodemulxnonepasspdepperlpopdpopqpurer10br10dr10lr10wr11br11dr11lr11wr12br12dr12lr12wr13br13"
+    "dr13lr13wr14br14dr14lr14wr15br15dr15lr15wrepzresbresqreswresyreszretfretnrorxrsdcrstsrunesahfsal"
+    "csallsalqsanssarlsarqsarxsetesetzsgdtshlxshowshrdshrzsidtsinhskipslotsmswsomespanstgisudosvdcsvt"
+    "stanhthistry!u128ud2aud2bumovusesvarsvec!verwwillworkxbtsxendxmm0xmm4xmm5xmm6xmm7xmm8xmm9yearymm"
+    "0ymm4ymm5ymm6ymm7ymm8ymm9zftpzmm0zmm4zmm5zmm6zmm7zmm8zmm9zptyztcpOFFaaaaadaamaasanyasmbdbbplbsrb"
+    "tcbyecbwch3ch4clccldcmccqocr0cr1cr2cr3cr4cr8cuedaydildotdr0dr2dr3dr8eaxebxgapgdbhexhlti16jaejbej"
+    "gejlejncjnejnojnpjnsjnzjpejpolfslgslslmixnavnegniloctpowpwdr0br0hr0lr0wr1br1dr1hr1lr1wr2br2hr2lr"
+    "2wr3br3hr3lr3wr4br4lr4wr5br5dr5lr5wr6br6dr6lr6wr7br7dr7lr7wr8br8dr8lr8wr9br9dr9lr9wraxrbprbxrcrr"
+    "dxrsmsbbsegsilst0st2st4st5st7tr3tr4tr5tr6tr7u16ud0ud1wrtzipDuDvDwFnbgi8jsjzk0k1k2k3k4k5k6k7u8";
+static const KeywordSlot luaKeywordsEntries[128] = {
+    {21625, 8, 4}, {0, 0, 0}, {4876, 7, 2}, {18723, 6, 2}, {28016, 5, 5}, {1751, 2, 2},
+    {8041, 4, 2}, {3966, 2, 5}, {21548, 5, 2}, {26585, 6, 4}, {0, 0, 0}, {24746, 6, 4},
+    {29597, 4, 5}, {28001, 5, 5}, {0, 0, 0}, {0, 0, 0}, {17508, 10, 4}, {16988, 10, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4421, 6, 4},
+    {2464, 3, 2}, {19032, 3, 2}, {17138, 10, 4}, {23584, 7, 5}, {5331, 2, 2}, {28106, 5, 2},
+    {24774, 7, 4}, {0, 0, 0}, {6794, 3, 2}, {0, 0, 0}, {19656, 9, 4}, {0, 0, 0},
+    {17388, 5, 4}, {0, 0, 0}, {0, 0, 0}, {26261, 6, 2}, {0, 0, 0}, {1753, 3, 2},
+    {24081, 7, 4}, {12528, 12, 4}, {26231, 6, 4}, {11924, 4, 4}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {16618, 10, 5}, {26969, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {4337, 5, 2}, {28006, 5, 5}, {0, 0, 0}, {11322, 4, 3}, {8649, 4, 4}, {14271, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {11083, 8, 4}, {0, 0, 0}, {0, 0, 0}, {9903, 5, 3},
+    {0, 0, 0}, {29601, 4, 5}, {0, 0, 0}, {0, 0, 0}, {22353, 8, 4}, {0, 0, 0},
+    {0, 0, 0}, {28011, 5, 5}, {0, 0, 0}, {16608, 10, 5}, {0, 0, 0}, {30575, 3, 3},
+    {26586, 5, 4}, {24095, 7, 4}, {0, 0, 0}, {306, 2, 2}, {0, 0, 0}, {0, 0, 0},
+    {24767, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29593, 4, 5},
+    {22209, 8, 4}, {26963, 6, 4}, {0, 0, 0}, {10692, 5, 5}, {25943, 6, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17488, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21809, 8, 4},
+    {0, 0, 0}, {0, 0, 0}, {14345, 11, 4}, {5831, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {18576, 9, 5}, {26261, 4, 2}, {22081, 8, 4}, {7962, 5, 4}, {28021, 5, 5}, {0, 0, 0},
+    {12084, 12, 4}, {0, 0, 0}, {0, 0, 0}, {24088, 7, 4}, {0, 0, 0}, {29081, 5, 2},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 luaKeywordsDisplacements[64] = {
+    0, 1, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 2, 0, 0, 0,
+    1, 0, 0, 1, 1, 0, 1, 1, 0, 6, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 4, 0, 0, 1,
+    3, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0,
+};
+const KeywordTable luaKeywords = { wordPool, luaKeywordsEntries, luaKeywordsDisplacements, 128, 64, 12, 0 };
+static const KeywordSlot cppKeywordsEntries[512] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 13, 2}, {19287, 9, 1}, {21353, 8, 2},
+    {29765, 4, 4}, {306, 2, 2}, {0, 0, 0}, {21313, 8, 1}, {23377, 7, 5}, {0, 0, 0},
+    {0, 0, 0}, {24907, 7, 4}, {28377, 4, 4}, {0, 0, 0}, {0, 0, 0}, {24291, 7, 4},
+    {0, 0, 0}, {29577, 4, 1}, {0, 0, 0}, {0, 0, 0}, {28576, 5, 4}, {0, 0, 0},
+    {1753, 3, 2}, {19032, 3, 2}, {17398, 6, 4}, {18720, 9, 2}, {22394, 7, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {24466, 7, 3}, {22147, 6, 2}, {24942, 7, 2}, {23654, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26903, 6, 2}, {7067, 18, 4}, {0, 0, 0},
+    {28991, 5, 4}, {19719, 9, 1}, {11279, 13, 1}, {27918, 5, 4}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {11292, 13, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {24803, 6, 1}, {0, 0, 0}, {24900, 7, 4}, {11322, 4, 3}, {27161, 6, 4}, {18756, 9, 2},
+    {0, 0, 0}, {26777, 6, 2}, {0, 0, 0}, {27263, 6, 2}, {24235, 7, 4}, {27245, 5, 2},
+    {26453, 6, 2}, {29709, 4, 4}, {12661, 11, 1}, {24438, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28451, 5, 5}, {0, 0, 0},
+    {30581, 3, 4}, {21905, 8, 2}, {0, 0, 0}, {0, 0, 0}, {21873, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28381, 5, 4}, {0, 0, 0}, {7555, 3, 2}, {0, 0, 0},
+    {26705, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18765, 9, 2}, {0, 0, 0},
+    {9241, 4, 1}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {19710, 9, 1}, {17568, 5, 4}, {11267, 12, 1}, {0, 0, 0}, {26207, 6, 2}, {0, 0, 0},
+    {4439, 5, 1}, {0, 0, 0}, {29729, 4, 4}, {0, 0, 0}, {0, 0, 0}, {29096, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23703, 7, 1}, {24858, 7, 4},
+    {10811, 4, 4}, {29809, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2446, 6, 2},
+    {27179, 6, 4}, {7064, 3, 4}, {0, 0, 0}, {24256, 7, 4}, {0, 0, 0}, {23598, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21345, 8, 2}, {17618, 9, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24844, 7, 4}, {0, 0, 0}, {22809, 8, 2},
+    {29689, 4, 4}, {29733, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {12224, 3, 4}, {27215, 6, 4}, {0, 0, 0}, {26717, 6, 4}, {24284, 7, 4}, {23675, 4, 1},
+    {26237, 6, 1}, {21753, 8, 4}, {0, 0, 0}, {16768, 10, 2}, {29810, 4, 4}, {0, 0, 0},
+    {29949, 4, 4}, {0, 0, 0}, {0, 0, 0}, {27991, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28351, 5, 4}, {0, 0, 0}, {29633, 4, 4}, {11254, 12, 1}, {24249, 7, 4},
+    {0, 0, 0}, {26561, 6, 2}, {0, 0, 0}, {0, 0, 0}, {22721, 8, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29076, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28251, 5, 5}, {19746, 5, 5},
+    {0, 0, 0}, {9903, 5, 3}, {26261, 4, 5}, {25551, 7, 4}, {0, 0, 0}, {21305, 8, 1},
+    {28806, 5, 4}, {19107, 9, 4}, {0, 0, 0}, {27986, 5, 1}, {22625, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {2767, 3, 4}, {26699, 6, 4}, {0, 0, 0}, {0, 0, 0}, {27185, 6, 4}, {16738, 7, 4},
+    {27191, 6, 4}, {28226, 5, 4}, {21561, 8, 2}, {30419, 3, 2}, {25961, 6, 2}, {18688, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {21817, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {22385, 8, 1}, {11084, 13, 4}, {18290, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {17538, 10, 4}, {22425, 8, 1}, {26471, 6, 4}, {30241, 4, 4},
+    {0, 0, 0}, {23338, 7, 4}, {0, 0, 0}, {0, 0, 0}, {24263, 7, 4}, {21457, 8, 2},
+    {24029, 3, 4}, {0, 0, 0}, {0, 0, 0}, {23507, 7, 1}, {0, 0, 0}, {26472, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6421, 3, 4}, {25229, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {9787, 14, 1}, {0, 0, 0}, {7077, 8, 4}, {0, 0, 0}, {5331, 2, 2},
+    {23337, 8, 4}, {24837, 7, 4}, {11266, 13, 1}, {7537, 8, 2}, {8508, 6, 5}, {8138, 16, 2},
+    {0, 0, 0}, {14403, 3, 4}, {27203, 6, 4}, {0, 0, 0}, {19711, 8, 1}, {0, 0, 0},
+    {0, 0, 0}, {23829, 7, 2}, {11032, 13, 4}, {0, 0, 0}, {2446, 3, 4}, {6874, 3, 2},
+    {24851, 7, 4}, {0, 0, 0}, {2656, 7, 5}, {28106, 5, 2}, {17658, 10, 4}, {22722, 7, 4},
+    {27935, 6, 2}, {24270, 7, 4}, {0, 0, 0}, {24896, 4, 4}, {8058, 16, 4}, {19458, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22377, 8, 2}, {27149, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23787, 7, 2}, {30245, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11033, 12, 4}, {28056, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22393, 8, 1}, {2473, 3, 4}, {23605, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24662, 7, 4}, {29605, 4, 4}, {29761, 4, 5},
+    {28376, 5, 4}, {29693, 4, 4}, {0, 0, 0}, {0, 0, 0}, {27306, 5, 1}, {0, 0, 0},
+    {26681, 6, 4}, {12660, 12, 1}, {0, 0, 0}, {0, 0, 0}, {11241, 12, 1}, {14142, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {4428, 3, 1}, {0, 0, 0}, {9801, 14, 1}, {0, 0, 0},
+    {0, 0, 0}, {22289, 8, 4}, {0, 0, 0}, {0, 0, 0}, {24690, 7, 4}, {19652, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {22401, 8, 1}, {24228, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27173, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {11952, 12, 2}, {27107, 6, 2}, {0, 0, 0}, {29841, 4, 2}, {27936, 5, 2},
+    {16738, 5, 2}, {0, 0, 0}, {0, 0, 0}, {22137, 8, 2}, {0, 0, 0}, {29777, 4, 4},
+    {7049, 18, 4}, {0, 0, 0}, {26087, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {24809, 7, 4}, {24956, 7, 1}, {18723, 6, 2}, {26443, 4, 4}, {27167, 6, 4},
+    {0, 0, 0}, {0, 0, 0}, {21548, 5, 2}, {2664, 6, 2}, {8727, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {11305, 13, 4}, {0, 0, 0}, {22427, 6, 1}, {0, 0, 0}, {18693, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {24802, 7, 1}, {0, 0, 0}, {12340, 5, 5}, {0, 0, 0},
+    {0, 0, 0}, {26711, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6794, 3, 2}, {0, 0, 0}, {0, 0, 0}, {26015, 6, 4},
+    {26009, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21249, 8, 4}, {22329, 8, 2},
+    {24957, 6, 1}, {0, 0, 0}, {21393, 8, 2}, {8723, 4, 5}, {0, 0, 0}, {0, 0, 0},
+    {25768, 7, 4}, {0, 0, 0}, {24277, 7, 4}, {23570, 7, 5}, {0, 0, 0}, {0, 0, 0},
+    {28611, 5, 4}, {23500, 7, 1}, {0, 0, 0}, {24298, 7, 4}, {0, 0, 0}, {24641, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7059, 8, 4}, {0, 0, 0}, {29569, 4, 3}, {8089, 3, 4}, {0, 0, 0},
+    {0, 0, 0}, {28126, 5, 2}, {0, 0, 0}, {10881, 3, 4}, {0, 0, 0}, {0, 0, 0},
+    {18774, 9, 2}, {0, 0, 0}, {26531, 6, 5}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0},
+    {26495, 6, 4}, {0, 0, 0}, {27209, 6, 4}, {30201, 4, 4}, {27221, 6, 1}, {26873, 6, 5},
+    {0, 0, 0}, {24830, 7, 4}, {0, 0, 0}, {11240, 13, 1}, {0, 0, 0}, {0, 0, 0},
+    {9815, 14, 1}, {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {14763, 11, 2}, {0, 0, 0},
+    {22386, 7, 1}, {0, 0, 0}, {0, 0, 0}, {30209, 4, 2}, {0, 0, 0}, {25761, 7, 1},
+    {11253, 13, 1}, {0, 0, 0}, {4902, 4, 4}, {0, 0, 0}, {0, 0, 0}, {19720, 8, 1},
+    {22402, 7, 1}, {12636, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29917, 4, 4},
+    {16768, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18885, 6, 2}, {0, 0, 0},
+};
+static const quint16 cppKeywordsDisplacements[128] = {
+    1, 2, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 3, 0,
+    0, 6, 0, 3, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2, 6,
+    0, 0, 0, 1, 0, 2, 1, 0, 0, 2, 0, 1, 0, 1, 0, 0,
+    2, 9, 2, 1, 2, 1, 4, 1, 0, 0, 1, 0, 1, 0, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 2, 0, 1,
+    0, 1, 2, 2, 6, 0, 0, 0, 2, 5, 0, 1, 1, 1, 0, 0,
+    2, 0, 2, 1, 4, 7, 0, 1, 0, 0, 3, 0, 6, 0, 0, 0,
+    0, 1, 2, 2, 0, 1, 0, 5, 0, 0, 0, 2, 0, 1, 1, 2,
+};
+const KeywordTable cppKeywords = { wordPool, cppKeywordsEntries, cppKeywordsDisplacements, 512, 128, 18, 0 };
+static const KeywordSlot shellKeywordsEntries[512] = {
+    {27275, 6, 4}, {29161, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27257, 6, 4}, {29685, 2, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14691, 4, 4}, {11201, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {19575, 4, 4}, {26209, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26501, 6, 4}, {0, 0, 0}, {0, 0, 0}, {18999, 9, 4}, {2477, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {29977, 4, 4}, {0, 0, 0}, {0, 0, 0}, {24965, 5, 4},
+    {0, 0, 0}, {21257, 8, 4}, {24872, 7, 4}, {0, 0, 0}, {2729, 2, 2}, {18513, 9, 4},
+    {0, 0, 0}, {5331, 2, 2}, {0, 0, 0}, {17648, 10, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3}, {9903, 5, 3}, {0, 0, 0},
+    {28666, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {27893, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27059, 6, 4},
+    {8890, 5, 4}, {0, 0, 0}, {23682, 7, 4}, {0, 0, 0}, {16457, 11, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30229, 4, 4}, {26255, 6, 4},
+    {8553, 4, 4}, {30361, 4, 4}, {26939, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23962, 7, 4}, {26999, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23449, 8, 4}, {4337, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10746, 13, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24963, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29166, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11928, 4, 4}, {19575, 9, 4}, {28646, 5, 4}, {0, 0, 0}, {29106, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28416, 5, 4}, {6807, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29773, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28691, 5, 4},
+    {0, 0, 0}, {4439, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19521, 9, 4}, {0, 0, 0},
+    {0, 0, 0}, {14271, 8, 2}, {0, 0, 0}, {24073, 2, 4}, {0, 0, 0}, {0, 0, 0},
+    {23647, 7, 4}, {19485, 9, 4}, {6375, 19, 4}, {0, 0, 0}, {8883, 15, 4}, {26249, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26965, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {29857, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24319, 4, 4},
+    {0, 0, 0}, {23773, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12380, 4, 4},
+    {29536, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27965, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21349, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8538, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18596, 2, 4},
+    {16861, 7, 4}, {29761, 4, 2}, {30397, 4, 4}, {0, 0, 0}, {0, 0, 0}, {29981, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24319, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19205, 3, 4}, {24883, 3, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 4}, {0, 0, 0}, {24102, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26249, 6, 4}, {0, 0, 0},
+    {8892, 6, 4}, {0, 0, 0}, {0, 0, 0}, {2484, 2, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {24354, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {19638, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {1987, 4, 4}, {1753, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18458, 10, 4}, {0, 0, 0}, {16748, 10, 4},
+    {0, 0, 0}, {24137, 7, 4}, {0, 0, 0}, {0, 0, 0}, {12336, 3, 4}, {21770, 5, 4},
+    {2767, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26213, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26225, 6, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26807, 6, 4}, {0, 0, 0},
+    {26945, 6, 4}, {0, 0, 0}, {30584, 3, 4}, {2473, 3, 4}, {24896, 4, 4}, {30393, 4, 4},
+    {0, 0, 0}, {26735, 6, 4}, {0, 0, 0}, {21385, 8, 4}, {0, 0, 0}, {24868, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {27959, 6, 4}, {14186, 5, 4}, {0, 0, 0}, {28636, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22413, 3, 4}, {11880, 12, 4}, {28141, 5, 4}, {0, 0, 0}, {29821, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17408, 10, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 4}, {0, 0, 0}, {0, 0, 0},
+    {8041, 4, 2}, {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {27281, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24949, 7, 4}, {19652, 4, 2}, {26261, 4, 2},
+    {0, 0, 0}, {18864, 9, 4}, {0, 0, 0}, {28151, 5, 4}, {0, 0, 0}, {2446, 6, 4},
+    {0, 0, 0}, {26081, 6, 4}, {0, 0, 0}, {0, 0, 0}, {17398, 10, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30509, 3, 4}, {24193, 7, 4}, {29541, 4, 4}, {0, 0, 0}, {4954, 5, 4},
+    {0, 0, 0}, {23871, 7, 4}, {21393, 8, 4}, {0, 0, 0}, {30787, 2, 4}, {28971, 5, 4},
+    {1755, 2, 4}, {0, 0, 0}, {0, 0, 0}, {23457, 8, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21377, 8, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22121, 8, 4}, {26639, 6, 4},
+    {7012, 2, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1751, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6790, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {24501, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25803, 7, 4}, {23766, 7, 4},
+    {19645, 3, 4}, {0, 0, 0}, {30434, 3, 4}, {18747, 9, 4}, {29901, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25810, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28286, 5, 4},
+    {0, 0, 0}, {19278, 9, 4}, {0, 0, 0}, {5831, 4, 4}, {29071, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28896, 5, 4}, {0, 0, 0}, {26771, 6, 4}, {0, 0, 0},
+    {29753, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 shellKeywordsDisplacements[128] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1,
+    2, 1, 0, 3, 2, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 1, 0,
+    1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 1, 0, 1, 0, 2, 1, 0, 0, 0, 0,
+    0, 0, 0, 3, 1, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+const KeywordTable shellKeywords = { wordPool, shellKeywordsEntries, shellKeywordsDisplacements, 512, 128, 19, 0 };
+static const KeywordSlot jsKeywordsEntries[512] = {
+    {21145, 8, 3}, {0, 0, 0}, {0, 0, 0}, {21129, 8, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {1751, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14691, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {21489, 8, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {6833, 18, 4}, {7528, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6815, 18, 4},
+    {0, 0, 0}, {23567, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {10590, 13, 4}, {5302, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8771, 6, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16558, 10, 4}, {0, 0, 0}, {6815, 9, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27269, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9166, 5, 4}, {22411, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19746, 9, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {7968, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11784, 12, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14092, 11, 4},
+    {0, 0, 0}, {29549, 4, 4}, {0, 0, 0}, {0, 0, 0}, {18885, 6, 2}, {0, 0, 0},
+    {4431, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18549, 9, 4}, {0, 0, 0},
+    {23794, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21945, 8, 4}, {16508, 10, 4},
+    {14004, 11, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0},
+    {27981, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21449, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {23948, 7, 2}, {0, 0, 0}, {0, 0, 0}, {6833, 9, 4}, {25937, 6, 4},
+    {26237, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4439, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25907, 6, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29016, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4876, 7, 4}, {0, 0, 0},
+    {24466, 4, 3}, {14271, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29553, 4, 4},
+    {17288, 10, 4}, {0, 0, 0}, {28508, 3, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {16518, 10, 4}, {25919, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7290, 17, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21348, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17584, 4, 2}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {28506, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25229, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5331, 2, 2},
+    {6874, 3, 2}, {0, 0, 0}, {23560, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {17026, 2, 2}, {23493, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23521, 7, 4}, {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {4428, 3, 1},
+    {0, 0, 0}, {23556, 7, 4}, {25901, 6, 4}, {28106, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {22409, 8, 4}, {0, 0, 0}, {23472, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30245, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {1753, 3, 2}, {28126, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27306, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26207, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23675, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2}, {10655, 13, 4}, {21721, 8, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11772, 12, 4}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {19652, 4, 2}, {26261, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {26209, 3, 2}, {14142, 5, 1}, {0, 0, 0}, {2446, 6, 2},
+    {0, 0, 0}, {23563, 7, 4}, {18684, 4, 1}, {0, 0, 0}, {0, 0, 0}, {29565, 4, 4},
+    {0, 0, 0}, {18468, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27905, 6, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {21817, 4, 1}, {14070, 11, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7302, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17018, 10, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14103, 11, 4}, {0, 0, 0},
+    {0, 0, 0}, {21201, 8, 4}, {0, 0, 0}, {21137, 8, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28051, 5, 2},
+    {16492, 6, 4}, {0, 0, 0}, {0, 0, 0}, {29561, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {18486, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16568, 10, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {9157, 14, 4}, {0, 0, 0},
+};
+static const quint16 jsKeywordsDisplacements[64] = {
+    0, 1, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 0, 2,
+};
+const KeywordTable jsKeywords = { wordPool, jsKeywordsEntries, jsKeywordsDisplacements, 512, 64, 18, 0 };
+static const KeywordSlot phpKeywordsEntries[512] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {306, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23577, 7, 5}, {0, 0, 0}, {14691, 4, 2}, {25829, 6, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1753, 3, 2}, {8218, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17388, 5, 2}, {0, 0, 0}, {0, 0, 0}, {18885, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24641, 7, 2}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21209, 8, 5}, {0, 0, 0},
+    {0, 0, 0}, {25931, 6, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {19125, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7555, 3, 2}, {12468, 12, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14279, 4, 1}, {0, 0, 0}, {1992, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21217, 8, 5},
+    {0, 0, 0}, {16861, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29621, 4, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {16868, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23948, 7, 2}, {21225, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23528, 7, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16871, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23514, 7, 5}, {0, 0, 0}, {4902, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5839, 20, 5},
+    {19134, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4876, 7, 5}, {29841, 4, 2},
+    {24466, 4, 3}, {21545, 8, 2}, {0, 0, 0}, {0, 0, 0}, {28251, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24896, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12336, 12, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6635, 18, 5}, {18688, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1000, 5, 5}, {0, 0, 0}, {16588, 10, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10681, 13, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7968, 2, 2},
+    {6874, 3, 2}, {8890, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {24070, 4, 2}, {4065, 3, 5},
+    {23479, 7, 5}, {0, 0, 0}, {2656, 7, 5}, {28106, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19458, 9, 2},
+    {0, 0, 0}, {6007, 4, 5}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {578, 3, 5}, {0, 0, 0},
+    {0, 0, 0}, {12168, 12, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28126, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11820, 12, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7395, 6, 2}, {7528, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26249, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26903, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28521, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28151, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23948, 5, 2}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2}, {29625, 4, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {19652, 4, 2}, {26261, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14142, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5331, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6794, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {16868, 10, 2}, {29041, 5, 2}, {26261, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16858, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {17018, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9221, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {18882, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18909, 9, 2}, {0, 0, 0}, {18567, 9, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {10356, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 phpKeywordsDisplacements[64] = {
+    0, 0, 0, 1, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1,
+    1, 2, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0,
+};
+const KeywordTable phpKeywords = { wordPool, phpKeywordsEntries, phpKeywordsDisplacements, 512, 64, 20, 0 };
+static const KeywordSlot qmlKeywordsEntries[512] = {
+    {21121, 8, 2}, {0, 0, 0}, {0, 0, 0}, {21129, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21489, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11929, 3, 1},
+    {8006, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6815, 18, 2},
+    {0, 0, 0}, {6824, 9, 1}, {0, 0, 0}, {22633, 8, 2}, {16788, 10, 2}, {0, 0, 0},
+    {0, 0, 0}, {5302, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8771, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16558, 10, 2}, {0, 0, 0}, {6815, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9166, 5, 2}, {22411, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12048, 12, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {14070, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11784, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14092, 11, 2},
+    {0, 0, 0}, {29549, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29817, 4, 2}, {0, 0, 0}, {0, 0, 0}, {18549, 9, 2}, {0, 0, 0},
+    {23794, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21945, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27981, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14004, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7528, 3, 2}, {0, 0, 0}, {0, 0, 0}, {6833, 9, 2}, {25937, 6, 2},
+    {21465, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {25026, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4902, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {14271, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29553, 4, 2},
+    {17288, 10, 2}, {21601, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8727, 6, 2}, {0, 0, 0}, {0, 0, 0}, {21153, 8, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25919, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7290, 17, 2}, {6451, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27905, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28506, 5, 2}, {19053, 9, 2},
+    {0, 0, 0}, {10590, 13, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23560, 3, 2}, {0, 0, 0}, {19242, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23493, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {23829, 7, 2}, {23521, 7, 2}, {0, 0, 0}, {0, 0, 0}, {18540, 9, 1}, {23567, 3, 2},
+    {0, 0, 0}, {23556, 7, 2}, {25901, 6, 2}, {0, 0, 0}, {0, 0, 0}, {22129, 4, 2},
+    {22409, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22121, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10655, 13, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14279, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16568, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23563, 7, 2}, {0, 0, 0},
+    {22625, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14691, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11912, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25817, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9157, 14, 2}, {21721, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {25907, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11772, 12, 2}, {0, 0, 0}, {3816, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4428, 3, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {16508, 10, 2}, {18468, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {3765, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29565, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7302, 5, 2},
+    {0, 0, 0}, {7365, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29557, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9221, 6, 2}, {14103, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {21201, 8, 2}, {0, 0, 0}, {6833, 18, 2}, {0, 0, 0}, {18522, 9, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16518, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29561, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {16492, 6, 2}, {0, 0, 0}, {0, 0, 0}, {22641, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {18486, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18540, 4, 1}, {18504, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 qmlKeywordsDisplacements[64] = {
+    0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1,
+};
+const KeywordTable qmlKeywords = { wordPool, qmlKeywordsEntries, qmlKeywordsDisplacements, 512, 64, 18, 0 };
+static const KeywordSlot pyKeywordsEntries[512] = {
+    {30273, 4, 4}, {0, 0, 0}, {22161, 8, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4868, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29969, 4, 2}, {0, 0, 0}, {14691, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1753, 3, 2}, {22805, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19503, 9, 4},
+    {18990, 9, 4}, {0, 0, 0}, {9900, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17388, 5, 2}, {0, 0, 0}, {0, 0, 0}, {27976, 5, 3}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {26069, 6, 4}, {26075, 5, 4}, {0, 0, 0}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26195, 6, 4}, {19080, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16663, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27941, 6, 4},
+    {30581, 3, 4}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {7968, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1998, 3, 4}, {29749, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28031, 5, 4},
+    {8553, 4, 2}, {0, 0, 0}, {17158, 10, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6484, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21705, 6, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23948, 7, 2}, {19507, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {21553, 8, 4}, {0, 0, 0}, {14403, 3, 4}, {0, 0, 0},
+    {11976, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23675, 4, 4},
+    {0, 0, 0}, {9493, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29046, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4439, 5, 4}, {7064, 3, 4}, {0, 0, 0}, {306, 2, 2}, {4902, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18891, 9, 4}, {0, 0, 0}, {0, 0, 0},
+    {8649, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {16668, 10, 4}, {26261, 4, 2}, {0, 0, 0}, {27942, 5, 4}, {0, 0, 0},
+    {29573, 4, 3}, {0, 0, 0}, {5330, 2, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29857, 4, 4}, {0, 0, 0}, {0, 0, 0}, {16598, 10, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {26993, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12380, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {22212, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30512, 3, 4}, {2827, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29016, 5, 4},
+    {21348, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12603, 3, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14158, 11, 4}, {26603, 6, 2},
+    {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8152, 3, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1753, 6, 4},
+    {30578, 3, 4}, {0, 0, 0}, {0, 0, 0}, {21289, 8, 4}, {0, 0, 0}, {4903, 2, 2},
+    {6874, 3, 2}, {0, 0, 0}, {0, 0, 0}, {19714, 3, 4}, {0, 0, 0}, {0, 0, 0},
+    {16738, 7, 4}, {0, 0, 0}, {0, 0, 0}, {19494, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2473, 3, 4},
+    {0, 0, 0}, {0, 0, 0}, {3765, 8, 4}, {28106, 5, 2}, {0, 0, 0}, {19456, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26219, 6, 4}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4431, 4, 2}, {0, 0, 0}, {17098, 10, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27137, 6, 4}, {7511, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {24970, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {24109, 7, 4}, {7395, 6, 2}, {4428, 3, 4}, {0, 0, 0}, {7051, 3, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29761, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19032, 3, 2}, {0, 0, 0}, {4934, 3, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2005, 3, 4},
+    {0, 0, 0}, {12060, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2484, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18909, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {30776, 3, 4}, {0, 0, 0}, {27287, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14142, 5, 2}, {17088, 10, 4}, {18684, 9, 4},
+    {0, 0, 0}, {10853, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6794, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21817, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23850, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28041, 5, 4}, {7968, 6, 2}, {8078, 3, 4}, {2819, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1751, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16843, 4, 4}, {21881, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12588, 12, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17584, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16838, 3, 2}, {0, 0, 0}, {0, 0, 0},
+    {30416, 3, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28051, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5831, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27005, 6, 4}, {29589, 4, 3}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 pyKeywordsDisplacements[64] = {
+    1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    1, 0, 0, 0, 1, 0, 1, 2, 0, 1, 0, 0, 1, 0, 1, 1,
+    2, 0, 1, 0, 1, 1, 0, 2, 0, 2, 0, 1, 0, 0, 1, 0,
+};
+const KeywordTable pyKeywords = { wordPool, pyKeywordsEntries, pyKeywordsDisplacements, 512, 64, 12, 0 };
+static const KeywordSlot rustKeywordsEntries[512] = {
+    {0, 0, 0}, {30277, 4, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {20337, 3, 1}, {0, 0, 0}, {29989, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23675, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {1753, 3, 2}, {8218, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8703, 15, 5}, {0, 0, 0}, {0, 0, 0},
+    {29581, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5331, 2, 2}, {0, 0, 0}, {0, 0, 0}, {12036, 12, 5}, {0, 0, 0},
+    {27107, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {27299, 6, 2}, {26903, 3, 2}, {27269, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29076, 5, 1}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {7968, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8938, 3, 1}, {0, 0, 0},
+    {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30249, 4, 5}, {0, 0, 0}, {0, 0, 0},
+    {10785, 13, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29101, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {12176, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25913, 6, 1}, {28306, 5, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29697, 4, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30764, 3, 1}, {26651, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21225, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7984, 10, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17598, 10, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23417, 8, 5}, {0, 0, 0},
+    {29016, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17418, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12252, 12, 5},
+    {0, 0, 0}, {9903, 5, 3}, {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {9831, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26813, 6, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18657, 9, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {8771, 3, 2}, {24746, 7, 5}, {0, 0, 0}, {18723, 6, 2}, {12264, 12, 5},
+    {0, 0, 0}, {30253, 4, 1}, {0, 0, 0}, {0, 0, 0}, {24984, 7, 2}, {0, 0, 0},
+    {21348, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {0, 0, 0}, {9255, 14, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {27221, 6, 1}, {28511, 5, 1}, {8152, 3, 1},
+    {7978, 16, 5}, {0, 0, 0}, {14462, 4, 5}, {28196, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11890, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18693, 4, 1}, {12105, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {30518, 3, 1}, {0, 0, 0}, {9895, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24070, 4, 2}, {23508, 3, 1},
+    {26885, 6, 5}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23605, 7, 2}, {0, 0, 0}, {7968, 10, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30789, 2, 1},
+    {23636, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28586, 5, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {9829, 14, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10791, 7, 5}, {0, 0, 0}, {0, 0, 0},
+    {21889, 8, 2}, {8908, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14455, 11, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12633, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27911, 6, 5}, {0, 0, 0},
+    {22057, 8, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11952, 3, 2}, {0, 0, 0}, {8953, 3, 1}, {0, 0, 0}, {0, 0, 0}, {21929, 8, 2},
+    {23948, 5, 2}, {0, 0, 0}, {0, 0, 0}, {12156, 12, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {29161, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {0, 0, 0}, {29721, 4, 5},
+    {0, 0, 0}, {0, 0, 0}, {26209, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12420, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6979, 4, 2}, {0, 0, 0},
+    {7426, 5, 2}, {0, 0, 0}, {29041, 5, 2}, {0, 0, 0}, {0, 0, 0}, {26075, 6, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {2664, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28051, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {8923, 3, 1}, {12180, 12, 5}, {0, 0, 0}, {1751, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25117, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25925, 6, 1},
+    {30811, 2, 1}, {23997, 7, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20328, 3, 1}, {0, 0, 0},
+    {16492, 6, 1}, {0, 0, 0}, {0, 0, 0}, {5831, 4, 2}, {0, 0, 0}, {13321, 2, 2},
+    {0, 0, 0}, {12672, 12, 5}, {0, 0, 0}, {0, 0, 0}, {23780, 7, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7962, 16, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 rustKeywordsDisplacements[64] = {
+    0, 0, 1, 0, 1, 1, 5, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 1, 1, 0, 2, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    2, 0, 1, 0, 0, 2, 0, 0, 0, 0, 1, 2, 0, 2, 1, 2,
+};
+const KeywordTable rustKeywords = { wordPool, rustKeywordsEntries, rustKeywordsDisplacements, 512, 64, 16, 0 };
+static const KeywordSlot javaKeywordsEntries[512] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26759, 6, 2}, {0, 0, 0}, {0, 0, 0}, {22065, 8, 2}, {0, 0, 0}, {17008, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {8196, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24641, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8771, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {19665, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {17638, 10, 2}, {12600, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23675, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18885, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22809, 8, 2},
+    {0, 0, 0}, {23913, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7528, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21225, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23948, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4439, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29016, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9903, 5, 3}, {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {8786, 7, 2}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17584, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25229, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5331, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7537, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6874, 3, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19458, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30245, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {1753, 3, 2}, {28126, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27306, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19652, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26903, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29841, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23948, 5, 2}, {0, 0, 0}, {22313, 8, 2}, {18723, 6, 2}, {24501, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {0, 0, 0}, {18693, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14142, 5, 1}, {0, 0, 0}, {4428, 3, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18684, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {24466, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {2010, 2, 2}, {21817, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9493, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7968, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17018, 10, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19134, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30269, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26237, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 javaKeywordsDisplacements[32] = {
+    0, 1, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1,
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+};
+const KeywordTable javaKeywords = { wordPool, javaKeywordsEntries, javaKeywordsDisplacements, 512, 32, 12, 0 };
+static const KeywordSlot csharpKeywordsEntries[512] = {
+    {28256, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19287, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {23377, 7, 5}, {24746, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {12340, 5, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21817, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29905, 4, 2},
+    {1753, 3, 2}, {26209, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18876, 6, 5},
+    {18621, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6388, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24641, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {19737, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27107, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {27299, 6, 2}, {0, 0, 0}, {27269, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21561, 8, 2}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21697, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27305, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21465, 8, 2}, {22275, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {24550, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29096, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18885, 6, 2}, {0, 0, 0},
+    {4431, 4, 2}, {0, 0, 0}, {29161, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21225, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {4903, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16668, 4, 2}, {23948, 7, 2}, {22809, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7528, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23675, 4, 1},
+    {26237, 6, 1}, {21348, 5, 2}, {0, 0, 0}, {24515, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4439, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {19134, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29841, 4, 2},
+    {24466, 4, 3}, {24965, 5, 2}, {0, 0, 0}, {0, 0, 0}, {28251, 5, 5}, {19746, 5, 5},
+    {0, 0, 0}, {0, 0, 0}, {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26819, 6, 2},
+    {8727, 6, 1}, {16871, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27053, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {9787, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {21705, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25229, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7968, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8508, 6, 5}, {0, 0, 0},
+    {17568, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {5332, 3, 2}, {2815, 3, 2}, {6874, 3, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12420, 3, 2},
+    {0, 0, 0}, {19739, 7, 2}, {0, 0, 0}, {0, 0, 0}, {11952, 7, 2}, {19458, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22121, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30245, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25117, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {28336, 5, 2}, {0, 0, 0}, {0, 0, 0}, {28126, 5, 2}, {2473, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29066, 5, 1}, {0, 0, 0}, {29761, 4, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27306, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6977, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7395, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26903, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2},
+    {4214, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21929, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2}, {0, 0, 0}, {1751, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {28106, 5, 2}, {19652, 4, 2}, {18693, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {14262, 5, 2}, {14142, 5, 1}, {18873, 9, 5}, {4428, 3, 1},
+    {0, 0, 0}, {10853, 6, 2}, {18684, 4, 1}, {0, 0, 0}, {5331, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {21669, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0},
+    {2664, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8723, 4, 5},
+    {28051, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16848, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27221, 6, 1}, {26873, 6, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23822, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21905, 8, 2}, {0, 0, 0}, {0, 0, 0}, {28871, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 csharpKeywordsDisplacements[64] = {
+    0, 1, 2, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 0, 2, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 2,
+};
+const KeywordTable csharpKeywords = { wordPool, csharpKeywordsEntries, csharpKeywordsDisplacements, 512, 64, 10, 0 };
+static const KeywordSlot goKeywordsEntries[512] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24746, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18596, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1753, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30133, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17388, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {11022, 3, 4}, {0, 0, 0}, {0, 0, 0}, {14104, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22401, 6, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14312, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18885, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {22385, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16738, 10, 1}, {0, 0, 0}, {0, 0, 0}, {22402, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7528, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23675, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16738, 7, 4}, {0, 0, 0},
+    {0, 0, 0}, {23969, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7064, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {19134, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9903, 5, 3}, {18738, 9, 1}, {0, 0, 0}, {27942, 5, 2}, {0, 0, 0},
+    {30575, 3, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8727, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {9787, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {8786, 7, 2}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14093, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2010, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22413, 3, 4},
+    {7907, 4, 2}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {22129, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24956, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25973, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26207, 6, 4}, {0, 0, 0}, {19652, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4934, 3, 4}, {0, 0, 0},
+    {22057, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14271, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28221, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19719, 7, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {0, 0, 0}, {29725, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21523, 5, 4}, {0, 0, 0}, {4428, 3, 1},
+    {23976, 7, 1}, {0, 0, 0}, {18684, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1734, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26813, 5, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29869, 4, 3}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19107, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27221, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5831, 4, 2}, {0, 0, 0}, {24697, 7, 4},
+    {0, 0, 0}, {22393, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {7291, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 goKeywordsDisplacements[32] = {
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 1, 1, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 2,
+};
+const KeywordTable goKeywords = { wordPool, goKeywordsEntries, goKeywordsDisplacements, 512, 32, 11, 0 };
+static const KeywordSlot vKeywordsEntries[128] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30789, 2, 1}, {9537, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {20337, 3, 1}, {0, 0, 0}, {16768, 5, 2}, {0, 0, 0}, {0, 0, 0}, {26261, 4, 2},
+    {18596, 2, 2}, {0, 0, 0}, {11322, 4, 3}, {30764, 3, 1}, {0, 0, 0}, {4428, 3, 1},
+    {18684, 4, 1}, {30518, 3, 1}, {0, 0, 0}, {23675, 4, 1}, {0, 0, 0}, {28106, 5, 2},
+    {0, 0, 0}, {30133, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1753, 3, 2},
+    {7064, 3, 1}, {0, 0, 0}, {306, 2, 2}, {0, 0, 0}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25229, 7, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29841, 4, 2}, {29965, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26903, 3, 2}, {0, 0, 0}, {0, 0, 0}, {9903, 5, 3},
+    {0, 0, 0}, {8923, 3, 1}, {9895, 4, 1}, {19134, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23689, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {30253, 4, 1}, {0, 0, 0}, {8727, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8908, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {8953, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20328, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5831, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28221, 5, 2}, {18885, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {27221, 6, 1}, {0, 0, 0}, {0, 0, 0}, {13321, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {18723, 6, 2},
+};
+static const quint16 vKeywordsDisplacements[32] = {
+    1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4,
+};
+const KeywordTable vKeywords = { wordPool, vKeywordsEntries, vKeywordsDisplacements, 128, 32, 9, 0 };
+static const KeywordSlot sqlKeywordsEntries[512] = {
+    {17164, 4, 2}, {26789, 6, 2}, {2770, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2729, 2, 2}, {11884, 8, 2}, {12675, 4, 2}, {0, 0, 0}, {22275, 4, 2},
+    {28791, 5, 2}, {14390, 4, 2}, {8090, 9, 2}, {19215, 4, 2}, {12492, 12, 2}, {0, 0, 0},
+    {0, 0, 0}, {8553, 7, 2}, {17418, 10, 2}, {23675, 4, 2}, {0, 0, 0}, {17259, 6, 2},
+    {1753, 3, 2}, {8218, 3, 2}, {22201, 8, 2}, {10759, 7, 2}, {16778, 10, 2}, {12288, 12, 2},
+    {0, 0, 0}, {17004, 4, 2}, {29741, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17388, 5, 2}, {24746, 6, 2}, {0, 0, 0}, {21521, 8, 2}, {0, 0, 0}, {28426, 5, 2},
+    {0, 0, 0}, {16818, 10, 2}, {0, 0, 0}, {0, 0, 0}, {23899, 7, 2}, {12648, 12, 2},
+    {24116, 7, 2}, {5331, 2, 2}, {0, 0, 0}, {26741, 6, 2}, {0, 0, 0}, {30479, 3, 2},
+    {16629, 9, 2}, {24207, 7, 2}, {28641, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {17618, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27029, 6, 2}, {17668, 10, 2}, {14271, 8, 2}, {0, 0, 0}, {16663, 5, 4}, {21889, 3, 2},
+    {23759, 7, 2}, {17538, 5, 2}, {28216, 5, 2}, {28581, 5, 2}, {4876, 7, 2}, {0, 0, 0},
+    {29076, 5, 2}, {26279, 6, 2}, {16888, 10, 2}, {17588, 10, 2}, {0, 0, 0}, {28856, 5, 2},
+    {7968, 2, 2}, {0, 0, 0}, {8277, 3, 2}, {0, 0, 0}, {19202, 4, 2}, {0, 0, 0},
+    {17488, 10, 2}, {0, 0, 0}, {24914, 7, 2}, {0, 0, 0}, {29091, 5, 2}, {26627, 6, 2},
+    {14809, 9, 2}, {0, 0, 0}, {17278, 10, 2}, {27101, 6, 2}, {16628, 5, 2}, {6869, 18, 2},
+    {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {11884, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {10815, 4, 2}, {29757, 4, 2}, {0, 0, 0}, {8723, 10, 2}, {0, 0, 0}, {29096, 5, 2},
+    {24585, 7, 2}, {0, 0, 0}, {0, 0, 0}, {26567, 6, 2}, {28136, 5, 2}, {0, 0, 0},
+    {17270, 4, 2}, {28366, 5, 2}, {0, 0, 0}, {0, 0, 0}, {30422, 3, 2}, {23377, 8, 2},
+    {6815, 3, 2}, {26267, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26651, 4, 2},
+    {24466, 4, 3}, {17504, 4, 2}, {14836, 4, 2}, {0, 0, 0}, {22345, 8, 2}, {22337, 8, 2},
+    {18657, 3, 2}, {21289, 4, 2}, {0, 0, 0}, {0, 0, 0}, {28236, 5, 2}, {7551, 5, 2},
+    {12291, 9, 2}, {0, 0, 0}, {30185, 4, 2}, {0, 0, 0}, {11322, 4, 3}, {27023, 6, 2},
+    {0, 0, 0}, {14413, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25985, 6, 2},
+    {0, 0, 0}, {17468, 10, 2}, {0, 0, 0}, {28206, 5, 2}, {11940, 12, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28031, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27293, 6, 2}, {4439, 5, 2}, {3816, 3, 2}, {0, 0, 0}, {14807, 11, 2}, {11924, 4, 2},
+    {24480, 7, 2}, {21817, 8, 2}, {8682, 6, 2}, {22297, 8, 2}, {27011, 6, 2}, {23990, 7, 2},
+    {14243, 3, 2}, {0, 0, 0}, {6388, 5, 2}, {0, 0, 0}, {28604, 3, 2}, {29841, 4, 2},
+    {24732, 7, 2}, {16638, 5, 2}, {0, 0, 0}, {0, 0, 0}, {22193, 8, 2}, {0, 0, 0},
+    {9511, 5, 2}, {9903, 5, 3}, {22805, 3, 4}, {23857, 7, 2}, {0, 0, 0}, {18621, 3, 2},
+    {26903, 6, 2}, {0, 0, 0}, {28631, 5, 2}, {0, 0, 0}, {24627, 7, 2}, {21361, 8, 2},
+    {12380, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {16758, 10, 2}, {21297, 8, 2}, {0, 0, 0}, {24823, 7, 2}, {0, 0, 0}, {24319, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {28571, 5, 4}, {0, 0, 0}, {0, 0, 0}, {23745, 7, 2},
+    {29905, 4, 2}, {23906, 7, 2}, {0, 0, 0}, {10720, 13, 2}, {0, 0, 0}, {8649, 4, 2},
+    {25997, 6, 2}, {16708, 10, 2}, {0, 0, 0}, {24550, 7, 2}, {18594, 9, 2}, {30217, 4, 2},
+    {12504, 12, 2}, {0, 0, 0}, {0, 0, 0}, {19422, 9, 2}, {0, 0, 0}, {22249, 8, 2},
+    {26285, 6, 2}, {21713, 8, 2}, {0, 0, 0}, {28836, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {17584, 4, 2}, {0, 0, 0}, {17461, 7, 2}, {24977, 7, 2}, {21857, 8, 2}, {0, 0, 0},
+    {8538, 6, 2}, {0, 0, 0}, {4954, 5, 2}, {28866, 5, 2}, {0, 0, 0}, {1753, 6, 4},
+    {19449, 9, 2}, {6351, 5, 4}, {21569, 8, 2}, {0, 0, 0}, {0, 0, 0}, {2777, 2, 2},
+    {16861, 7, 2}, {0, 0, 0}, {7404, 5, 2}, {18693, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28026, 5, 2}, {14235, 8, 2}, {23702, 5, 2}, {19714, 3, 4}, {23829, 7, 2},
+    {28801, 5, 2}, {0, 0, 0}, {28466, 5, 2}, {10811, 13, 2}, {2464, 3, 2}, {8078, 3, 2},
+    {0, 0, 0}, {29861, 4, 2}, {27924, 5, 2}, {28106, 5, 2}, {0, 0, 0}, {22129, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {19352, 7, 2}, {0, 0, 0}, {0, 0, 0}, {14524, 5, 2},
+    {16678, 10, 2}, {18909, 6, 2}, {14774, 11, 2}, {24718, 7, 2}, {0, 0, 0}, {23822, 7, 2},
+    {0, 0, 0}, {19494, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29061, 5, 4},
+    {24123, 7, 2}, {0, 0, 0}, {0, 0, 0}, {6451, 5, 2}, {0, 0, 0}, {16628, 10, 2},
+    {28336, 5, 2}, {22361, 8, 2}, {16838, 10, 2}, {0, 0, 0}, {2473, 3, 2}, {24487, 7, 2},
+    {0, 0, 0}, {26201, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17608, 10, 2},
+    {24558, 3, 4}, {26237, 6, 2}, {24634, 7, 2}, {24445, 7, 2}, {0, 0, 0}, {30329, 4, 2},
+    {23619, 7, 2}, {0, 0, 0}, {4431, 4, 2}, {0, 0, 0}, {14708, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {19530, 9, 2}, {12258, 4, 2}, {0, 0, 0}, {23878, 7, 2}, {0, 0, 0},
+    {12511, 5, 2}, {7395, 6, 2}, {0, 0, 0}, {0, 0, 0}, {4337, 5, 2}, {0, 0, 0},
+    {21441, 8, 2}, {0, 0, 0}, {19077, 3, 4}, {26207, 6, 2}, {24896, 4, 2}, {19652, 4, 2},
+    {14279, 4, 2}, {19782, 9, 2}, {23675, 7, 2}, {24928, 7, 2}, {4934, 3, 4}, {12312, 5, 2},
+    {22145, 8, 2}, {19190, 6, 2}, {19611, 9, 2}, {21665, 8, 2}, {0, 0, 0}, {26345, 6, 2},
+    {4214, 3, 2}, {0, 0, 0}, {0, 0, 0}, {14235, 11, 2}, {7051, 5, 2}, {21669, 4, 2},
+    {0, 0, 0}, {19313, 3, 4}, {23836, 7, 2}, {0, 0, 0}, {1760, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {9241, 14, 2}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0}, {8636, 7, 2},
+    {30289, 4, 2}, {24725, 7, 2}, {24361, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8041, 4, 2}, {12653, 6, 2}, {29161, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {18846, 9, 2}, {8718, 15, 2}, {4868, 3, 4}, {14246, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21523, 5, 2}, {19746, 9, 2}, {4428, 3, 2},
+    {23434, 7, 2}, {21033, 9, 2}, {26273, 6, 2}, {2484, 4, 2}, {27155, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {21849, 8, 2}, {0, 0, 0}, {0, 0, 0}, {29957, 4, 2}, {12512, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {24193, 7, 2}, {9194, 5, 2}, {22074, 7, 2}, {8723, 5, 2},
+    {12283, 5, 2}, {23871, 7, 2}, {21393, 8, 2}, {22265, 8, 2}, {26261, 6, 2}, {0, 0, 0},
+    {22153, 8, 2}, {1998, 6, 2}, {26063, 6, 2}, {0, 0, 0}, {9304, 4, 2}, {21505, 8, 2},
+    {27047, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18693, 9, 2}, {0, 0, 0},
+    {24979, 5, 2}, {26729, 6, 2}, {0, 0, 0}, {19161, 9, 2}, {18819, 9, 2}, {0, 0, 0},
+    {8771, 3, 4}, {21913, 8, 2}, {26537, 6, 2}, {0, 0, 0}, {1751, 2, 2}, {22281, 8, 2},
+    {0, 0, 0}, {19269, 9, 2}, {29745, 4, 2}, {0, 0, 0}, {19332, 9, 2}, {0, 0, 0},
+    {19728, 9, 2}, {14262, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22425, 8, 2}, {28471, 5, 2}, {0, 0, 0}, {29909, 4, 2}, {0, 0, 0}, {9493, 14, 2},
+    {0, 0, 0}, {12535, 6, 2}, {17148, 10, 2}, {0, 0, 0}, {8545, 8, 2}, {18963, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {27131, 6, 2}, {23752, 7, 2}, {4884, 6, 2}, {26555, 6, 2},
+    {30416, 3, 2}, {24781, 7, 2}, {29673, 4, 2}, {0, 0, 0}, {10772, 13, 2}, {28811, 5, 2},
+    {8673, 15, 2}, {28116, 5, 2}, {27035, 6, 2}, {25754, 7, 2}, {14642, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19431, 9, 2}, {27893, 4, 2}, {0, 0, 0},
+    {10798, 13, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17154, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {26513, 6, 2},
+};
+static const quint16 sqlKeywordsDisplacements[256] = {
+    5, 1, 0, 1, 3, 0, 0, 3, 4, 6, 0, 0, 0, 2, 1, 0,
+    1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 2, 1, 0, 0, 0, 0, 1, 3, 4, 1, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 2, 2,
+    1, 1, 0, 2, 0, 1, 1, 5, 0, 0, 1, 0, 1, 1, 0, 1,
+    0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 2, 2, 0, 0, 0, 0,
+    1, 0, 2, 1, 4, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0,
+    1, 0, 1, 2, 1, 0, 0, 1, 0, 4, 1, 0, 0, 0, 3, 2,
+    2, 0, 0, 0, 6, 1, 1, 1, 0, 1, 4, 0, 1, 2, 1, 0,
+    0, 1, 3, 0, 2, 0, 1, 4, 0, 0, 0, 1, 3, 0, 0, 1,
+    1, 1, 3, 2, 0, 1, 0, 0, 1, 3, 0, 0, 3, 5, 0, 0,
+    2, 0, 0, 2, 0, 4, 1, 1, 0, 1, 1, 0, 2, 2, 1, 0,
+    10, 0, 0, 0, 2, 2, 2, 0, 5, 0, 3, 0, 2, 1, 0, 1,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 4,
+    0, 0, 2, 3, 2, 0, 1, 0, 4, 0, 10, 2, 0, 1, 1, 0,
+    1, 0, 5, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 2, 3, 0,
+};
+const KeywordTable sqlKeywords = { wordPool, sqlKeywordsEntries, sqlKeywordsDisplacements, 512, 256, 18, 1 };
+static const KeywordSlot jsonKeywordsEntries[4] = {
+    {0, 0, 0}, {9903, 5, 3}, {24466, 4, 3}, {11322, 4, 3},
+};
+static const quint16 jsonKeywordsDisplacements[1] = {
+    0,
+};
+const KeywordTable jsonKeywords = { wordPool, jsonKeywordsEntries, jsonKeywordsDisplacements, 4, 1, 5, 0 };
+static const KeywordSlot cssKeywordsEntries[512] = {
+    {27017, 6, 1}, {0, 0, 0}, {21265, 8, 1}, {0, 0, 0}, {0, 0, 0}, {24473, 7, 1},
+    {0, 0, 0}, {30506, 3, 1}, {19224, 9, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30569, 3, 1}, {11855, 4, 1}, {28036, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21678, 3, 1}, {0, 0, 0},
+    {8006, 4, 1}, {8277, 3, 1}, {30476, 3, 1}, {30205, 4, 1}, {16720, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {26064, 4, 1}, {0, 0, 0}, {0, 0, 0}, {2477, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {9194, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14554, 11, 1}, {26201, 6, 1}, {0, 0, 0},
+    {28901, 5, 1}, {0, 0, 0}, {0, 0, 0}, {18950, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {24529, 7, 1}, {0, 0, 0}, {23801, 7, 1}, {11104, 6, 1}, {0, 0, 0}, {0, 0, 0},
+    {26519, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25949, 6, 1},
+    {0, 0, 0}, {19755, 9, 1}, {0, 0, 0}, {0, 0, 0}, {26057, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26609, 6, 1}, {1745, 1, 1}, {18612, 9, 1}, {0, 0, 0},
+    {17463, 5, 1}, {14243, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28856, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {24494, 7, 1}, {26575, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19206, 9, 1}, {17628, 10, 1}, {14836, 4, 1},
+    {9793, 4, 1}, {0, 0, 0}, {16828, 10, 1}, {0, 0, 0}, {24130, 7, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19237, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {29849, 4, 1}, {0, 0, 0}, {23808, 7, 1}, {23857, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {16888, 4, 1}, {29817, 4, 1}, {0, 0, 0}, {4395, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8545, 8, 1},
+    {4342, 9, 1}, {0, 0, 0}, {26687, 6, 1}, {23752, 6, 1}, {19219, 5, 1}, {0, 0, 0},
+    {6954, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21889, 6, 1}, {7551, 5, 1},
+    {27899, 6, 1}, {0, 0, 0}, {0, 0, 0}, {24816, 7, 1}, {0, 0, 0}, {24144, 7, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16648, 10, 1}, {24522, 7, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23640, 7, 1}, {0, 0, 0},
+    {25026, 7, 1}, {0, 0, 0}, {27966, 5, 1}, {0, 0, 0}, {0, 0, 0}, {28696, 5, 1},
+    {11976, 6, 1}, {4439, 5, 1}, {9246, 9, 1}, {0, 0, 0}, {0, 0, 0}, {14703, 5, 1},
+    {0, 0, 0}, {14488, 11, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5853, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {14271, 8, 1}, {22049, 8, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27942, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28626, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6351, 5, 1},
+    {27197, 6, 1}, {21921, 8, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {6501, 6, 1}, {22649, 8, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {24970, 7, 1}, {0, 0, 0}, {0, 0, 0}, {16658, 10, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23696, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10815, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30285, 4, 1}, {0, 0, 0}, {26801, 6, 1}, {0, 0, 0}, {0, 0, 0}, {19116, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {7556, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23633, 7, 1}, {0, 0, 0}, {24480, 7, 1}, {0, 0, 0}, {1748, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12105, 3, 1}, {23888, 4, 1},
+    {0, 0, 0}, {28026, 5, 1}, {0, 0, 0}, {19215, 9, 1}, {19714, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26615, 6, 1}, {28046, 5, 1}, {2464, 3, 1}, {4868, 3, 1},
+    {0, 0, 0}, {0, 0, 0}, {3765, 8, 1}, {28106, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25991, 6, 1}, {19602, 9, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28076, 5, 1}, {0, 0, 0}, {0, 0, 0}, {9194, 5, 1}, {0, 0, 0}, {26693, 6, 1},
+    {0, 0, 0}, {0, 0, 0}, {28526, 5, 1}, {0, 0, 0}, {4390, 7, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27113, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28121, 5, 1}, {24305, 7, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4936, 4, 1}, {0, 0, 0}, {17948, 10, 1},
+    {0, 0, 0}, {0, 0, 0}, {23752, 7, 1}, {0, 0, 0}, {0, 0, 0}, {18855, 9, 1},
+    {0, 0, 0}, {0, 0, 0}, {2447, 1, 1}, {22217, 8, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28131, 5, 1}, {12258, 4, 1}, {0, 0, 0}, {0, 0, 0}, {29957, 4, 1},
+    {0, 0, 0}, {26051, 6, 1}, {0, 0, 0}, {0, 0, 0}, {30566, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19215, 4, 1}, {0, 0, 0}, {26951, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {17488, 6, 1}, {0, 0, 0}, {22253, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26291, 6, 1}, {0, 0, 0}, {5764, 4, 1}, {0, 0, 0},
+    {11982, 6, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7051, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16918, 4, 1}, {29805, 4, 1},
+    {0, 0, 0}, {29131, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21929, 8, 1},
+    {26093, 6, 1}, {2770, 6, 1}, {0, 0, 0}, {0, 0, 0}, {9241, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {26573, 6, 1}, {6391, 2, 1}, {23885, 7, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {3816, 5, 1}, {29171, 5, 1}, {27062, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {29176, 5, 1}, {0, 0, 0}, {0, 0, 0}, {3780, 9, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27251, 6, 1}, {29645, 4, 1}, {30221, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21369, 8, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22329, 8, 1},
+    {0, 0, 0}, {19792, 5, 1}, {21513, 8, 1}, {8723, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28986, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {28036, 5, 1}, {24536, 7, 1}, {0, 0, 0}, {5313, 1, 1}, {24312, 7, 1}, {22835, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {8078, 3, 1}, {19161, 9, 1}, {1992, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28751, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30153, 4, 1}, {0, 0, 0}, {6484, 5, 1},
+    {0, 0, 0}, {24070, 4, 1}, {0, 0, 0}, {0, 0, 0}, {27095, 6, 1}, {0, 0, 0},
+    {29845, 4, 1}, {0, 0, 0}, {0, 0, 0}, {16638, 10, 1}, {22185, 8, 1}, {0, 0, 0},
+    {0, 0, 0}, {25126, 5, 1}, {24795, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7545, 6, 1}, {26243, 6, 1}, {27143, 6, 1}, {14197, 5, 1},
+    {0, 0, 0}, {26549, 6, 1}, {4902, 4, 1}, {5831, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {7475, 5, 1}, {0, 0, 0}, {6333, 4, 1}, {12029, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 cssKeywordsDisplacements[128] = {
+    1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2,
+    0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 3, 0, 0, 3, 0,
+    1, 2, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0,
+    0, 1, 0, 0, 2, 0, 0, 3, 0, 0, 2, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 3, 0, 4, 2, 2, 0, 1, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1,
+    0, 0, 1, 1, 5, 0, 1, 0, 0, 1, 0, 1, 1, 1, 0, 0,
+};
+const KeywordTable cssKeywords = { wordPool, cssKeywordsEntries, cssKeywordsDisplacements, 512, 128, 11, 0 };
+static const KeywordSlot typescriptKeywordsEntries[256] = {
+    {25229, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19287, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {7968, 2, 2}, {6874, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {22355, 6, 4}, {16558, 10, 4}, {2815, 3, 2}, {0, 0, 0}, {23493, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23829, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {6833, 18, 4}, {30416, 3, 4}, {28051, 5, 2}, {0, 0, 0}, {25901, 6, 4}, {17008, 10, 2},
+    {0, 0, 0}, {11772, 12, 4}, {0, 0, 0}, {27905, 6, 4}, {23472, 7, 4}, {0, 0, 0},
+    {10590, 13, 4}, {5302, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24641, 7, 2}, {2729, 2, 2}, {0, 0, 0},
+    {30245, 4, 2}, {0, 0, 0}, {21145, 8, 3}, {8771, 6, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {16861, 7, 2}, {0, 0, 0}, {14103, 11, 4}, {0, 0, 0}, {28126, 5, 2},
+    {2473, 3, 2}, {0, 0, 0}, {0, 0, 0}, {27269, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9166, 5, 4}, {22411, 6, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25919, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21945, 8, 4}, {7528, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19458, 9, 2}, {0, 0, 0}, {16492, 6, 4}, {26207, 6, 2},
+    {14279, 4, 1}, {0, 0, 0}, {0, 0, 0}, {25907, 6, 4}, {0, 0, 0}, {26903, 6, 2},
+    {23675, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11784, 12, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14092, 11, 4},
+    {27245, 5, 2}, {22409, 8, 4}, {0, 0, 0}, {14004, 11, 4}, {18885, 6, 2}, {0, 0, 0},
+    {4431, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18549, 9, 4}, {2446, 6, 2},
+    {23794, 7, 4}, {0, 0, 0}, {6815, 18, 4}, {0, 0, 0}, {21225, 8, 2}, {18723, 6, 2},
+    {10655, 13, 4}, {21721, 8, 4}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {29565, 4, 4}, {0, 0, 0}, {16768, 5, 2}, {28106, 5, 2},
+    {19652, 4, 2}, {23913, 7, 2}, {0, 0, 0}, {0, 0, 0}, {26209, 3, 2}, {14142, 5, 1},
+    {0, 0, 0}, {23948, 7, 2}, {0, 0, 0}, {0, 0, 0}, {6833, 9, 4}, {0, 0, 0},
+    {5331, 2, 2}, {21348, 5, 2}, {0, 0, 0}, {18468, 9, 4}, {0, 0, 0}, {0, 0, 0},
+    {6815, 9, 4}, {0, 0, 0}, {0, 0, 0}, {29549, 4, 4}, {0, 0, 0}, {21489, 8, 4},
+    {16568, 10, 4}, {1753, 3, 2}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0},
+    {14070, 11, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9903, 5, 3},
+    {29016, 5, 2}, {0, 0, 0}, {0, 0, 0}, {17018, 10, 2}, {4876, 7, 4}, {16508, 10, 4},
+    {24466, 4, 3}, {14271, 8, 2}, {0, 0, 0}, {0, 0, 0}, {14691, 4, 4}, {0, 0, 0},
+    {0, 0, 0}, {7302, 5, 4}, {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1751, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29553, 4, 4},
+    {17288, 10, 4}, {0, 0, 0}, {28508, 3, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8727, 6, 4}, {0, 0, 0}, {0, 0, 0}, {21201, 8, 4}, {0, 0, 0}, {21137, 8, 4},
+    {11322, 4, 3}, {16518, 10, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7290, 17, 4}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2}, {29561, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5831, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {18486, 9, 4}, {19746, 9, 3}, {0, 0, 0}, {21129, 8, 4},
+    {17584, 4, 2}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {28506, 5, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {9157, 14, 4}, {0, 0, 0},
+};
+static const quint16 typescriptKeywordsDisplacements[64] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 3, 1, 1, 0, 0, 0, 0, 0, 0, 1, 2,
+    2, 1, 0, 2, 0, 0, 0, 1, 2, 0, 1, 1, 2, 3, 1, 0,
+};
+const KeywordTable typescriptKeywords = { wordPool, typescriptKeywordsEntries, typescriptKeywordsDisplacements, 256, 64, 18, 0 };
+static const KeywordSlot yamlKeywordsEntries[4] = {
+    {0, 0, 0}, {9903, 5, 3}, {24466, 4, 3}, {11322, 4, 3},
+};
+static const quint16 yamlKeywordsDisplacements[1] = {
+    0,
+};
+const KeywordTable yamlKeywords = { wordPool, yamlKeywordsEntries, yamlKeywordsDisplacements, 4, 1, 5, 0 };
+static const KeywordSlot vexKeywordsEntries[1024] = {
+    {9535, 8, 4}, {0, 0, 0}, {9549, 14, 4}, {7898, 16, 4}, {12540, 12, 4}, {19242, 7, 1},
+    {10928, 10, 4}, {2729, 2, 2}, {0, 0, 0}, {0, 0, 0}, {23377, 7, 4}, {24746, 6, 4},
+    {24333, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9465, 14, 4}, {14224, 11, 4},
+    {10902, 13, 4}, {7443, 17, 4}, {4972, 22, 4}, {2708, 26, 4}, {0, 0, 0}, {29905, 4, 4},
+    {1753, 3, 2}, {5819, 16, 4}, {27221, 6, 1}, {9507, 14, 4}, {21617, 8, 4}, {8448, 15, 4},
+    {0, 0, 0}, {22161, 7, 4}, {10928, 13, 4}, {14367, 11, 4}, {7429, 3, 4}, {0, 0, 0},
+    {14147, 11, 4}, {17259, 9, 4}, {28536, 5, 4}, {0, 0, 0}, {10850, 13, 4}, {11149, 13, 4},
+    {12444, 12, 4}, {0, 0, 0}, {9479, 9, 4}, {6851, 13, 4}, {6918, 10, 4}, {0, 0, 0},
+    {18438, 10, 4}, {0, 0, 0}, {0, 0, 0}, {9381, 14, 4}, {12432, 12, 4}, {19017, 9, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8026, 16, 4}, {14675, 11, 4}, {14334, 11, 4},
+    {0, 0, 0}, {24046, 7, 4}, {11188, 13, 4}, {18666, 9, 4}, {24823, 5, 4}, {23425, 8, 4},
+    {0, 0, 0}, {0, 0, 0}, {12144, 12, 4}, {11006, 13, 4}, {0, 0, 0}, {0, 0, 0},
+    {24242, 7, 4}, {7409, 17, 4}, {0, 0, 0}, {12216, 12, 4}, {14730, 11, 4}, {26879, 6, 4},
+    {24466, 4, 3}, {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {8643, 10, 4}, {0, 0, 0}, {16876, 3, 4}, {9432, 5, 4}, {6451, 11, 4}, {8628, 15, 4},
+    {11162, 13, 4}, {8958, 15, 4}, {8090, 9, 4}, {27017, 6, 4}, {19260, 9, 4}, {19251, 9, 4},
+    {12408, 12, 4}, {9283, 14, 4}, {0, 0, 0}, {12060, 12, 4}, {11227, 13, 4}, {22169, 8, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29641, 4, 4}, {8808, 15, 4}, {7435, 8, 4},
+    {2760, 16, 4}, {29086, 5, 4}, {14612, 8, 4}, {21825, 8, 4}, {16948, 10, 4}, {0, 0, 0},
+    {19647, 9, 4}, {24942, 7, 1}, {12276, 12, 4}, {26849, 6, 4}, {17238, 10, 4}, {30443, 3, 4},
+    {6851, 4, 4}, {24004, 7, 4}, {11110, 13, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {14598, 11, 4}, {29605, 4, 4}, {14719, 6, 4}, {26099, 5, 4}, {12384, 12, 4}, {0, 0, 0},
+    {29633, 4, 4}, {17208, 10, 4}, {0, 0, 0}, {0, 0, 0}, {21689, 8, 4}, {0, 0, 0},
+    {0, 0, 0}, {5825, 6, 4}, {19557, 9, 4}, {0, 0, 0}, {10347, 14, 4}, {0, 0, 0},
+    {29689, 4, 4}, {23843, 7, 4}, {17248, 10, 4}, {0, 0, 0}, {14403, 3, 4}, {0, 0, 0},
+    {14451, 4, 1}, {4994, 22, 4}, {26825, 6, 4}, {8583, 15, 4}, {28206, 5, 4}, {12108, 12, 4},
+    {19305, 9, 4}, {14634, 8, 4}, {0, 0, 0}, {0, 0, 0}, {10866, 8, 4}, {24676, 7, 4},
+    {25967, 6, 4}, {17198, 9, 4}, {21937, 8, 4}, {0, 0, 0}, {10353, 8, 4}, {22361, 5, 4},
+    {18603, 9, 4}, {28351, 5, 4}, {0, 0, 0}, {7426, 17, 4}, {19071, 9, 4}, {28977, 4, 4},
+    {5899, 16, 4}, {14467, 10, 4}, {19368, 9, 4}, {0, 0, 0}, {5825, 10, 4}, {4934, 3, 4},
+    {0, 0, 0}, {17298, 10, 4}, {18688, 5, 4}, {6941, 18, 4}, {7460, 17, 4}, {30485, 3, 4},
+    {17058, 10, 4}, {0, 0, 0}, {16958, 10, 4}, {12228, 12, 4}, {28251, 5, 5}, {19746, 5, 5},
+    {0, 0, 0}, {21321, 8, 4}, {28331, 5, 4}, {0, 0, 0}, {14818, 11, 4}, {5395, 21, 4},
+    {11175, 13, 4}, {22433, 8, 4}, {9213, 14, 4}, {23441, 8, 4}, {24753, 7, 4}, {11832, 9, 4},
+    {0, 0, 0}, {22441, 8, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26531, 6, 5}, {28036, 4, 4}, {19080, 9, 4}, {0, 0, 0}, {12624, 12, 4}, {17478, 10, 4},
+    {8727, 6, 1}, {22641, 7, 1}, {27041, 6, 4}, {17389, 4, 4}, {16918, 10, 4}, {10694, 13, 4},
+    {21969, 8, 4}, {9535, 14, 4}, {30440, 3, 4}, {0, 0, 0}, {14543, 11, 4}, {9339, 14, 4},
+    {0, 0, 0}, {11097, 6, 4}, {0, 0, 0}, {14323, 11, 4}, {8523, 15, 4}, {11928, 12, 4},
+    {29873, 4, 4}, {12420, 12, 4}, {12300, 12, 4}, {0, 0, 0}, {21633, 8, 4}, {30241, 4, 4},
+    {9199, 8, 4}, {21977, 8, 4}, {6851, 18, 4}, {0, 0, 0}, {19170, 9, 4}, {19701, 9, 4},
+    {19188, 9, 4}, {17338, 10, 4}, {22113, 8, 4}, {10837, 8, 4}, {0, 0, 0}, {8793, 15, 4},
+    {8598, 15, 4}, {14477, 11, 4}, {4332, 20, 4}, {0, 0, 0}, {19404, 9, 4}, {14499, 11, 4},
+    {0, 0, 0}, {21473, 8, 4}, {0, 0, 0}, {0, 0, 0}, {6489, 19, 4}, {5331, 2, 2},
+    {12552, 12, 4}, {10889, 13, 4}, {0, 0, 0}, {19714, 3, 4}, {19512, 9, 4}, {12372, 12, 4},
+    {6959, 4, 4}, {14579, 8, 4}, {6959, 18, 4}, {18981, 9, 4}, {28146, 5, 4}, {5819, 12, 4},
+    {17188, 10, 4}, {4950, 22, 4}, {0, 0, 0}, {0, 0, 0}, {23629, 4, 4}, {26941, 3, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {12140, 4, 4},
+    {6451, 19, 4}, {11832, 12, 4}, {29076, 5, 1}, {0, 0, 0}, {4283, 23, 4}, {0, 0, 0},
+    {0, 0, 0}, {8733, 15, 4}, {0, 0, 0}, {12348, 12, 4}, {24669, 7, 4}, {17448, 7, 4},
+    {25782, 7, 4}, {30779, 2, 4}, {9353, 14, 4}, {18290, 4, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5819, 20, 4}, {0, 0, 0}, {19008, 9, 4}, {21961, 8, 4}, {28056, 5, 4},
+    {20385, 9, 4}, {12624, 9, 4}, {9633, 14, 4}, {0, 0, 0}, {2473, 3, 4}, {0, 0, 0},
+    {8122, 16, 4}, {0, 0, 0}, {16978, 10, 4}, {14601, 8, 4}, {25973, 6, 4}, {0, 0, 0},
+    {24558, 3, 4}, {5248, 21, 4}, {6356, 19, 4}, {4966, 6, 4}, {4352, 23, 4}, {14444, 11, 4},
+    {23393, 8, 4}, {10954, 13, 4}, {0, 0, 0}, {14356, 11, 2}, {24459, 7, 4}, {29637, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6905, 18, 4}, {0, 0, 0},
+    {19233, 9, 4}, {9395, 14, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10759, 13, 4},
+    {17038, 10, 4}, {17498, 10, 4}, {17848, 10, 4}, {0, 0, 0}, {8000, 10, 4}, {8170, 16, 4},
+    {24375, 7, 1}, {0, 0, 0}, {0, 0, 0}, {9745, 14, 4}, {30781, 2, 4}, {16968, 10, 4},
+    {0, 0, 0}, {19584, 9, 4}, {10837, 13, 4}, {14186, 5, 4}, {17328, 10, 4}, {12576, 12, 4},
+    {12434, 4, 4}, {4329, 22, 4}, {0, 0, 0}, {21865, 8, 4}, {0, 0, 0}, {5779, 20, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7358, 17, 4}, {17108, 10, 4}, {26123, 6, 4},
+    {8823, 15, 4}, {18837, 8, 4}, {8282, 16, 4}, {29036, 5, 4}, {14620, 11, 4}, {0, 0, 0},
+    {0, 0, 0}, {28061, 5, 4}, {6337, 19, 4}, {16998, 10, 4}, {21609, 8, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {14301, 11, 4}, {3816, 5, 1}, {14213, 11, 4}, {29681, 4, 4}, {26261, 4, 2},
+    {0, 0, 0}, {11844, 12, 4}, {0, 0, 0}, {19345, 5, 4}, {18408, 10, 4}, {28531, 5, 4},
+    {0, 0, 0}, {11932, 6, 4}, {16922, 6, 4}, {0, 0, 0}, {17228, 10, 4}, {19089, 9, 4},
+    {0, 0, 0}, {9605, 14, 4}, {19467, 9, 4}, {0, 0, 0}, {0, 0, 0}, {15577, 11, 4},
+    {0, 0, 0}, {9493, 5, 4}, {24193, 7, 1}, {19099, 8, 4}, {9647, 14, 4}, {21497, 8, 4},
+    {14390, 10, 4}, {0, 0, 0}, {22073, 8, 4}, {0, 0, 0}, {4352, 22, 4}, {12060, 9, 4},
+    {14576, 10, 4}, {6962, 7, 4}, {17218, 10, 4}, {0, 0, 0}, {0, 0, 0}, {9465, 9, 4},
+    {14623, 8, 4}, {9591, 14, 4}, {0, 0, 0}, {17258, 10, 4}, {0, 0, 0}, {12432, 7, 4},
+    {0, 0, 0}, {10941, 13, 4}, {17108, 6, 4}, {11136, 13, 4}, {0, 0, 0}, {24879, 7, 4},
+    {12420, 7, 4}, {12396, 12, 4}, {18729, 9, 4}, {21481, 8, 4}, {8089, 3, 4}, {16971, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {24074, 7, 4}, {18957, 6, 4}, {17039, 9, 4}, {0, 0, 0},
+    {0, 0, 0}, {12480, 12, 4}, {22625, 6, 1}, {11982, 6, 4}, {9255, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30201, 4, 4}, {0, 0, 0}, {26873, 6, 5},
+    {24151, 7, 4}, {26117, 6, 4}, {12612, 12, 4}, {19413, 9, 4}, {11695, 12, 4}, {26099, 6, 4},
+    {0, 0, 0}, {0, 0, 0}, {22147, 4, 4}, {0, 0, 0}, {0, 0, 0}, {17398, 6, 4},
+    {0, 0, 0}, {24900, 7, 4}, {0, 0, 0}, {0, 0, 0}, {9367, 14, 4}, {7914, 16, 4},
+    {0, 0, 0}, {14719, 11, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21801, 8, 4},
+    {8643, 15, 4}, {2760, 26, 4}, {0, 0, 0}, {6318, 19, 4}, {24235, 7, 4}, {0, 0, 0},
+    {14631, 11, 4}, {2734, 26, 4}, {4260, 23, 4}, {16362, 5, 4}, {0, 0, 0}, {0, 0, 0},
+    {18792, 9, 4}, {4329, 23, 4}, {5899, 20, 4}, {0, 0, 0}, {9619, 14, 4}, {16284, 6, 4},
+    {0, 0, 0}, {29853, 4, 4}, {9720, 11, 4}, {7429, 2, 4}, {0, 0, 0}, {6470, 19, 4},
+    {0, 0, 0}, {17308, 10, 4}, {8173, 13, 4}, {24907, 7, 4}, {30783, 2, 4}, {19341, 9, 4},
+    {21673, 8, 4}, {0, 0, 0}, {12372, 6, 4}, {5311, 21, 4}, {19314, 9, 4}, {0, 0, 0},
+    {24347, 7, 4}, {19359, 6, 4}, {28321, 3, 4}, {10881, 3, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {18837, 9, 4}, {0, 0, 0}, {11006, 6, 4}, {8568, 15, 4}, {26443, 4, 4},
+    {0, 0, 0}, {12192, 12, 4}, {24704, 7, 4}, {12324, 12, 4}, {21006, 9, 4}, {21737, 8, 4},
+    {0, 0, 0}, {7930, 16, 4}, {10824, 13, 4}, {22241, 8, 4}, {10707, 13, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {17178, 10, 4}, {0, 0, 0}, {25955, 6, 4}, {24788, 7, 4},
+    {12132, 12, 4}, {19026, 9, 4}, {0, 0, 0}, {24340, 7, 4}, {5353, 21, 4}, {21337, 8, 4},
+    {0, 0, 0}, {23626, 7, 4}, {0, 0, 0}, {0, 0, 0}, {7938, 3, 4}, {17198, 10, 4},
+    {14785, 11, 4}, {8868, 15, 4}, {8433, 15, 4}, {6923, 18, 4}, {0, 0, 0}, {9451, 14, 4},
+    {23892, 7, 4}, {0, 0, 0}, {0, 0, 0}, {2786, 26, 4}, {0, 0, 0}, {0, 0, 0},
+    {5879, 20, 4}, {6959, 14, 4}, {30581, 3, 4}, {0, 0, 0}, {7545, 11, 4}, {26753, 6, 4},
+    {19629, 9, 4}, {24655, 7, 4}, {14579, 7, 4}, {9563, 14, 4}, {9431, 6, 4}, {7882, 16, 4},
+    {11071, 13, 4}, {11976, 12, 4}, {10837, 9, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {8250, 16, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12300, 7, 4},
+    {8748, 15, 4}, {0, 0, 0}, {21051, 9, 4}, {8958, 10, 4}, {17049, 9, 4}, {0, 0, 0},
+    {0, 0, 0}, {6484, 5, 4}, {0, 0, 0}, {9661, 14, 4}, {29729, 4, 4}, {18675, 9, 4},
+    {12340, 5, 4}, {26765, 6, 4}, {9537, 6, 4}, {3821, 24, 4}, {8613, 15, 4}, {16446, 11, 4},
+    {0, 0, 0}, {6797, 18, 4}, {7914, 11, 4}, {0, 0, 0}, {0, 0, 0}, {18630, 9, 4},
+    {9409, 14, 4}, {0, 0, 0}, {14576, 11, 4}, {28321, 5, 4}, {6451, 15, 4}, {24256, 7, 4},
+    {14686, 11, 4}, {7013, 18, 4}, {8266, 16, 4}, {0, 0, 0}, {14290, 11, 4}, {8682, 6, 4},
+    {0, 0, 0}, {9731, 14, 4}, {19593, 5, 4}, {5899, 12, 4}, {16928, 10, 4}, {0, 0, 0},
+    {4355, 19, 4}, {0, 0, 0}, {19440, 9, 4}, {14609, 11, 4}, {6995, 18, 4}, {4997, 19, 4},
+    {0, 0, 0}, {0, 0, 0}, {22625, 7, 1}, {21649, 8, 4}, {0, 0, 0}, {21729, 8, 4},
+    {6432, 19, 4}, {19377, 9, 4}, {0, 0, 0}, {19683, 9, 4}, {24508, 7, 4}, {0, 0, 0},
+    {10863, 13, 4}, {14202, 11, 4}, {0, 0, 0}, {0, 0, 0}, {19476, 9, 4}, {0, 0, 0},
+    {0, 0, 0}, {21537, 8, 4}, {24179, 7, 4}, {4439, 5, 1}, {5759, 15, 4}, {9703, 14, 4},
+    {0, 0, 0}, {12312, 12, 4}, {0, 0, 0}, {14358, 9, 4}, {0, 0, 0}, {0, 0, 0},
+    {8838, 15, 4}, {21548, 5, 2}, {14411, 11, 4}, {24711, 7, 4}, {21321, 7, 4}, {7545, 6, 4},
+    {22805, 3, 4}, {19296, 9, 4}, {26351, 6, 4}, {0, 0, 0}, {0, 0, 0}, {17048, 10, 4},
+    {19197, 9, 4}, {0, 0, 0}, {0, 0, 0}, {9903, 5, 3}, {26663, 6, 4}, {12603, 3, 4},
+    {14590, 8, 4}, {18885, 6, 4}, {24158, 7, 4}, {17438, 10, 4}, {0, 0, 0}, {12456, 12, 4},
+    {4355, 20, 4}, {14664, 11, 4}, {19179, 9, 4}, {7497, 14, 4}, {19692, 9, 4}, {0, 0, 0},
+    {5269, 21, 4}, {0, 0, 0}, {0, 0, 0}, {4279, 4, 4}, {16808, 10, 4}, {21024, 9, 4},
+    {22177, 8, 4}, {11928, 10, 4}, {5764, 4, 4}, {16871, 7, 2}, {8186, 16, 4}, {0, 0, 0},
+    {16878, 10, 4}, {0, 0, 0}, {0, 0, 0}, {25229, 4, 1}, {9731, 6, 4}, {0, 0, 0},
+    {18723, 6, 2}, {19620, 9, 4}, {6959, 10, 4}, {8122, 11, 4}, {0, 0, 0}, {18900, 9, 4},
+    {11058, 13, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19098, 9, 4}, {0, 0, 0},
+    {0, 0, 0}, {21329, 8, 4}, {0, 0, 0}, {28754, 3, 4}, {0, 0, 0}, {28486, 5, 4},
+    {18702, 9, 4}, {18954, 9, 4}, {24029, 3, 4}, {13284, 12, 4}, {14224, 7, 4}, {10694, 7, 4},
+    {28516, 5, 4}, {16688, 10, 4}, {10824, 7, 4}, {21015, 9, 4}, {8042, 16, 4}, {11045, 13, 4},
+    {0, 0, 0}, {5882, 17, 4}, {9577, 14, 4}, {0, 0, 0}, {0, 0, 0}, {24382, 7, 1},
+    {0, 0, 0}, {7494, 17, 4}, {0, 0, 0}, {17388, 10, 4}, {0, 0, 0}, {0, 0, 0},
+    {8508, 6, 5}, {19062, 9, 4}, {2770, 6, 1}, {4306, 23, 4}, {9675, 14, 4}, {0, 0, 0},
+    {26645, 6, 4}, {0, 0, 0}, {9689, 14, 4}, {13944, 12, 4}, {0, 0, 0}, {24018, 7, 4},
+    {19350, 9, 4}, {2767, 3, 4}, {16898, 10, 4}, {21897, 8, 4}, {2656, 7, 5}, {0, 0, 0},
+    {0, 0, 0}, {14510, 11, 4}, {9423, 14, 4}, {2446, 3, 4}, {0, 0, 0}, {19395, 9, 4},
+    {16938, 10, 4}, {12096, 12, 4}, {21339, 6, 4}, {21321, 3, 4}, {0, 0, 0}, {26795, 6, 4},
+    {0, 0, 0}, {10876, 13, 4}, {27527, 6, 4}, {22105, 8, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9717, 14, 4}, {8622, 11, 4}, {6451, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {14587, 11, 4}, {7545, 17, 4}, {24326, 7, 4}, {8673, 5, 4},
+    {0, 0, 0}, {0, 0, 0}, {11592, 6, 2}, {8487, 6, 4}, {19368, 5, 4}, {0, 0, 0},
+    {17558, 10, 4}, {18918, 9, 4}, {0, 0, 0}, {14389, 11, 4}, {24564, 7, 4}, {23612, 7, 4},
+    {0, 0, 0}, {14433, 11, 4}, {19323, 9, 4}, {0, 0, 0}, {17018, 8, 4}, {0, 0, 0},
+    {9460, 5, 4}, {9199, 14, 4}, {0, 0, 0}, {0, 0, 0}, {7480, 14, 4}, {0, 0, 0},
+    {0, 0, 0}, {8010, 16, 4}, {14271, 8, 2}, {0, 0, 0}, {4428, 3, 1}, {0, 0, 0},
+    {7051, 3, 4}, {0, 0, 0}, {24683, 7, 4}, {0, 0, 0}, {14820, 9, 4}, {0, 0, 0},
+    {5825, 14, 4}, {0, 0, 0}, {0, 0, 0}, {21681, 8, 4}, {14466, 11, 4}, {0, 0, 0},
+    {28451, 5, 5}, {25783, 6, 4}, {0, 0, 0}, {28326, 5, 4}, {9492, 3, 4}, {28976, 5, 4},
+    {26129, 6, 4}, {23864, 7, 4}, {26111, 6, 4}, {0, 0, 0}, {12120, 12, 4}, {10993, 13, 4},
+    {0, 0, 0}, {18828, 9, 4}, {9521, 14, 4}, {0, 0, 0}, {0, 0, 0}, {7365, 10, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {5759, 20, 4}, {17378, 9, 4}, {0, 0, 0}, {0, 0, 0}, {8090, 16, 4}, {0, 0, 0},
+    {5374, 21, 4}, {24159, 6, 4}, {21281, 8, 4}, {9479, 14, 4}, {17458, 10, 4}, {0, 0, 0},
+    {0, 0, 0}, {28611, 5, 4}, {0, 0, 0}, {29769, 4, 4}, {5819, 6, 4}, {4421, 23, 4},
+    {4868, 3, 4}, {12317, 7, 4}, {7426, 5, 4}, {3773, 24, 4}, {0, 0, 0}, {8463, 9, 4},
+    {14378, 11, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17448, 10, 4}, {8154, 16, 4},
+    {0, 0, 0}, {17268, 10, 4}, {24571, 7, 4}, {23338, 7, 4}, {21841, 8, 4}, {14136, 11, 4},
+    {8478, 15, 4}, {8463, 15, 4}, {14114, 11, 4}, {7511, 17, 4}, {12072, 12, 4}, {17838, 10, 4},
+    {8658, 15, 4}, {14202, 9, 4}, {25979, 6, 4}, {19137, 3, 4}, {21745, 8, 4}, {14257, 11, 4},
+    {0, 0, 0}, {10867, 7, 4}, {0, 0, 0}, {0, 0, 0}, {18972, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {7511, 9, 4}, {7994, 16, 4}, {21689, 4, 4}, {19035, 9, 4}, {0, 0, 0},
+    {26003, 6, 4}, {14653, 11, 4}, {19242, 6, 1}, {17168, 10, 4}, {12382, 3, 4}, {0, 0, 0},
+    {14741, 11, 4}, {11097, 13, 4}, {0, 0, 0}, {19359, 9, 4}, {0, 0, 0}, {0, 0, 0},
+    {24067, 7, 4}, {17548, 10, 4}, {23710, 7, 4}, {7392, 17, 4}, {0, 0, 0}, {17578, 10, 4},
+    {4332, 19, 4}, {21585, 8, 4}, {17378, 10, 4}, {25796, 7, 4}, {7477, 17, 4}, {19674, 9, 4},
+    {0, 0, 0}, {17318, 10, 4}, {3797, 24, 4}, {21833, 8, 4}, {17028, 10, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21042, 9, 4}, {4950, 16, 4}, {0, 0, 0}, {11695, 13, 4},
+    {11322, 4, 3}, {26105, 6, 4}, {14422, 11, 4}, {0, 0, 0}, {0, 0, 0}, {8853, 15, 4},
+    {0, 0, 0}, {17413, 4, 4}, {11856, 12, 4}, {22369, 8, 4}, {6413, 19, 4}, {0, 0, 0},
+    {0, 0, 0}, {23815, 7, 4}, {27203, 6, 4}, {0, 0, 0}, {11123, 13, 4}, {19386, 9, 4},
+    {30193, 4, 4}, {9227, 14, 4}, {21338, 7, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21241, 8, 4}, {21641, 8, 4}, {8748, 10, 4}, {19593, 9, 4}, {0, 0, 0},
+    {10915, 13, 4}, {6492, 16, 4}, {14697, 11, 4}, {18693, 4, 1},
+};
+static const quint16 vexKeywordsDisplacements[512] = {
+    1, 3, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    3, 3, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0,
+    3, 0, 0, 1, 4, 0, 0, 5, 0, 1, 0, 0, 0, 0, 1, 0,
+    1, 0, 1, 3, 0, 0, 5, 6, 0, 2, 0, 0, 3, 0, 1, 0,
+    3, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0,
+    1, 0, 0, 1, 0, 0, 0, 1, 1, 2, 7, 1, 1, 0, 0, 0,
+    0, 3, 0, 0, 2, 1, 3, 1, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 4, 1, 4, 2, 3, 0, 0, 1, 0, 1, 2,
+    1, 0, 0, 1, 1, 0, 0, 1, 7, 0, 1, 2, 5, 1, 0, 0,
+    0, 0, 0, 0, 2, 0, 1, 1, 0, 6, 0, 0, 0, 6, 0, 1,
+    0, 3, 1, 0, 3, 0, 0, 1, 0, 0, 2, 0, 4, 2, 0, 1,
+    0, 6, 0, 0, 1, 1, 0, 0, 0, 1, 0, 3, 1, 2, 3, 3,
+    0, 2, 3, 2, 4, 0, 0, 0, 0, 4, 0, 5, 0, 1, 1, 0,
+    0, 4, 1, 0, 2, 0, 2, 0, 2, 1, 0, 1, 2, 0, 0, 2,
+    0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 0, 3, 0, 0, 2, 0,
+    0, 0, 2, 1, 1, 2, 6, 3, 4, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 1, 0, 0, 2, 0, 0, 6, 1, 1, 0, 0, 0, 1,
+    1, 3, 1, 1, 3, 1, 2, 0, 0, 1, 8, 4, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 6, 0, 0, 2, 0, 2, 0, 0, 0,
+    1, 1, 0, 0, 0, 3, 0, 0, 1, 4, 0, 2, 1, 1, 0, 1,
+    4, 1, 0, 3, 2, 0, 0, 0, 3, 0, 0, 4, 1, 0, 5, 1,
+    4, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 4, 0, 1, 4, 0,
+    8, 0, 2, 0, 0, 1, 0, 2, 0, 3, 1, 2, 0, 2, 2, 0,
+    5, 0, 0, 1, 0, 14, 0, 7, 1, 0, 0, 0, 8, 3, 0, 0,
+    1, 1, 1, 1, 0, 3, 0, 0, 0, 5, 2, 0, 3, 3, 2, 1,
+    0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 3, 0, 4, 0, 1, 4,
+    3, 5, 10, 0, 0, 10, 0, 0, 0, 0, 1, 3, 0, 0, 0, 10,
+    1, 1, 1, 2, 2, 1, 4, 0, 5, 1, 0, 5, 1, 0, 0, 1,
+    1, 1, 7, 0, 1, 0, 0, 0, 2, 8, 0, 0, 1, 5, 4, 1,
+    2, 8, 1, 2, 25, 2, 2, 1, 2, 2, 0, 1, 2, 3, 1, 0,
+};
+const KeywordTable vexKeywords = { wordPool, vexKeywordsEntries, vexKeywordsDisplacements, 1024, 512, 26, 0 };
+static const KeywordSlot cmakeKeywordsEntries[1024] = {
+    {4802, 5, 5}, {0, 0, 0}, {7093, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11868, 12, 2}, {2729, 2, 2}, {6599, 18, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {2656, 26, 2}, {0, 0, 0}, {0, 0, 0}, {364, 8, 4}, {1468, 30, 5}, {5995, 19, 5},
+    {0, 0, 0}, {6977, 18, 2}, {0, 0, 0}, {3324, 15, 4}, {7578, 16, 5}, {0, 0, 0},
+    {2176, 27, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5479, 20, 5},
+    {5938, 19, 5}, {0, 0, 0}, {0, 0, 0}, {9297, 14, 2}, {0, 0, 0}, {0, 0, 0},
+    {4802, 16, 4}, {0, 0, 0}, {0, 0, 0}, {6794, 3, 2}, {2964, 25, 5}, {9003, 14, 4},
+    {12360, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6707, 18, 5},
+    {9143, 14, 4}, {973, 32, 5}, {0, 0, 0}, {11892, 12, 2}, {8218, 16, 2}, {25835, 6, 5},
+    {6242, 19, 4}, {0, 0, 0}, {0, 0, 0}, {6052, 19, 5}, {2203, 27, 5}, {0, 0, 0},
+    {3349, 15, 4}, {0, 0, 0}, {0, 0, 0}, {6569, 12, 4}, {0, 0, 0}, {4686, 22, 5},
+    {9759, 14, 2}, {2041, 27, 5}, {14271, 8, 2}, {3461, 24, 5}, {6299, 19, 2}, {2864, 25, 5},
+    {0, 0, 0}, {2812, 6, 2}, {4137, 8, 4}, {3701, 24, 4}, {11808, 12, 4}, {11760, 12, 5},
+    {8890, 5, 2}, {0, 0, 0}, {23465, 7, 5}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {626, 9, 4}, {0, 0, 0}, {10499, 13, 5},
+    {24389, 7, 2}, {25865, 6, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26261, 4, 2}, {0, 0, 0}, {7307, 17, 4}, {676, 20, 5}, {0, 0, 0}, {0, 0, 0},
+    {1646, 29, 5}, {3961, 15, 5}, {170, 42, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7205, 17, 5}, {0, 0, 0}, {0, 0, 0}, {1438, 30, 5},
+    {0, 0, 0}, {0, 0, 0}, {5038, 13, 5}, {0, 0, 0}, {3845, 24, 2}, {5101, 21, 5},
+    {10980, 13, 2}, {940, 33, 4}, {0, 0, 0}, {0, 0, 0}, {5038, 21, 5}, {21193, 8, 4},
+    {0, 0, 0}, {2506, 7, 4}, {3485, 24, 5}, {0, 0, 0}, {3164, 25, 5}, {21185, 8, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21169, 8, 5}, {0, 0, 0},
+    {1685, 19, 4}, {1201, 25, 4}, {0, 0, 0}, {0, 0, 0}, {6887, 18, 2}, {11796, 12, 5},
+    {0, 0, 0}, {24368, 7, 2}, {7031, 18, 2}, {14037, 11, 4}, {0, 0, 0}, {3869, 23, 4},
+    {14268, 11, 2}, {4099, 23, 4}, {7137, 17, 5}, {1354, 24, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25841, 6, 4}, {8298, 15, 4}, {7103, 17, 5}, {6394, 19, 2}, {0, 0, 0},
+    {9843, 14, 2}, {1528, 30, 5}, {1762, 28, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {3629, 24, 5}, {0, 0, 0}, {21545, 8, 2}, {0, 0, 0}, {306, 2, 2}, {6033, 19, 5},
+    {7222, 17, 4}, {0, 0, 0}, {0, 0, 0}, {29953, 4, 2}, {5539, 20, 5}, {7770, 16, 4},
+    {0, 0, 0}, {7239, 17, 4}, {0, 0, 0}, {19566, 9, 2}, {17078, 10, 2}, {1324, 24, 4},
+    {0, 0, 0}, {1133, 31, 5}, {0, 0, 0}, {0, 0, 0}, {28251, 5, 2}, {5599, 20, 5},
+    {0, 0, 0}, {0, 0, 0}, {3677, 24, 4}, {5164, 21, 5}, {0, 0, 0}, {0, 0, 0},
+    {25883, 6, 5}, {0, 0, 0}, {6001, 13, 4}, {0, 0, 0}, {4884, 22, 2}, {4752, 22, 5},
+    {10525, 13, 5}, {0, 0, 0}, {11214, 7, 2}, {1069, 32, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11916, 12, 2}, {0, 0, 0},
+    {8727, 6, 2}, {0, 0, 0}, {16578, 10, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {24172, 7, 2}, {0, 0, 0}, {0, 0, 0}, {2122, 27, 5},
+    {0, 0, 0}, {7528, 17, 2}, {21105, 8, 4}, {0, 0, 0}, {6581, 18, 5}, {5044, 7, 4},
+    {3383, 6, 4}, {2604, 26, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3},
+    {5739, 20, 4}, {7802, 16, 4}, {516, 25, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7610, 16, 5},
+    {1588, 29, 5}, {0, 0, 0}, {0, 0, 0}, {11526, 13, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6166, 19, 4}, {0, 0, 0}, {5185, 21, 5}, {3892, 23, 5},
+    {8373, 15, 4}, {4007, 23, 5}, {6743, 18, 4}, {1384, 24, 4}, {0, 0, 0}, {3961, 23, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6617, 18, 5}, {5679, 20, 5}, {4375, 23, 2},
+    {2284, 27, 5}, {0, 0, 0}, {8313, 15, 4}, {0, 0, 0}, {0, 0, 0}, {575, 6, 4},
+    {6128, 19, 5}, {1348, 30, 5}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {21113, 8, 4},
+    {7722, 16, 4}, {5437, 21, 2}, {0, 0, 0}, {1824, 22, 4}, {30401, 3, 3}, {24921, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {14180, 11, 2}, {0, 0, 0}, {5206, 21, 5}, {0, 0, 0},
+    {16698, 10, 2}, {0, 0, 0}, {0, 0, 0}, {3533, 24, 5}, {0, 0, 0}, {4398, 23, 2},
+    {2068, 27, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5565, 14, 4}, {3189, 25, 5}, {0, 0, 0}, {252, 25, 5}, {0, 0, 0},
+    {5719, 20, 4}, {1408, 30, 5}, {0, 0, 0}, {4466, 22, 4}, {0, 0, 0}, {16868, 10, 2},
+    {10512, 13, 5}, {0, 0, 0}, {25889, 6, 5}, {4648, 16, 4}, {1378, 30, 5}, {0, 0, 0},
+    {8763, 15, 2}, {2095, 17, 5}, {808, 19, 5}, {0, 0, 0}, {0, 0, 0}, {2838, 26, 2},
+    {373, 27, 4}, {0, 0, 0}, {14565, 11, 2}, {436, 35, 5}, {9073, 14, 4}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {907, 33, 4}, {0, 0, 0}, {0, 0, 0}, {25859, 6, 5},
+    {0, 0, 0}, {0, 0, 0}, {2392, 27, 4}, {643, 33, 5}, {9857, 14, 2}, {8508, 15, 2},
+    {0, 0, 0}, {7324, 17, 4}, {0, 0, 0}, {2500, 26, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2149, 27, 5}, {5458, 21, 2},
+    {0, 0, 0}, {12564, 12, 2}, {6401, 12, 2}, {6662, 9, 4}, {7085, 12, 2}, {0, 0, 0},
+    {1704, 29, 4}, {0, 0, 0}, {7738, 16, 4}, {2446, 27, 2}, {2484, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {8388, 15, 4}, {14796, 11, 2}, {6508, 19, 2}, {4145, 23, 4},
+    {0, 0, 0}, {10629, 8, 4}, {6689, 18, 4}, {1733, 29, 2}, {14048, 11, 4}, {0, 0, 0},
+    {5639, 20, 5}, {0, 0, 0}, {4598, 22, 5}, {7562, 16, 4}, {0, 0, 0}, {5957, 19, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5122, 21, 5}, {0, 0, 0},
+    {0, 0, 0}, {1288, 30, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {2365, 27, 4}, {4862, 22, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2812, 26, 2},
+    {0, 0, 0}, {3984, 18, 5}, {5619, 20, 5}, {0, 0, 0}, {9773, 14, 2}, {9031, 14, 4},
+    {0, 0, 0}, {12000, 12, 2}, {6261, 19, 4}, {6779, 18, 2}, {6725, 18, 5}, {0, 0, 0},
+    {0, 0, 0}, {4928, 22, 2}, {27996, 5, 4}, {5659, 20, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {8403, 15, 4}, {0, 0, 0}, {0, 0, 0}, {709, 33, 5}, {0, 0, 0},
+    {9171, 14, 4}, {0, 0, 0}, {0, 0, 0}, {4554, 22, 5}, {0, 0, 0}, {1195, 31, 5},
+    {0, 0, 0}, {4796, 22, 5}, {0, 0, 0}, {9101, 14, 4}, {16468, 10, 5}, {18477, 9, 4},
+    {0, 0, 0}, {7818, 16, 4}, {4714, 16, 4}, {0, 0, 0}, {9185, 14, 2}, {5031, 6, 2},
+    {8304, 9, 4}, {1037, 26, 5}, {6790, 7, 2}, {0, 0, 0}, {1818, 28, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {14026, 11, 5}, {5059, 21, 5}, {4444, 22, 4}, {0, 0, 0},
+    {0, 0, 0}, {1318, 8, 5}, {1005, 32, 5}, {3039, 25, 5}, {0, 0, 0}, {0, 0, 0},
+    {5458, 15, 2}, {1101, 32, 5}, {2914, 25, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {7754, 16, 4}, {0, 0, 0}, {218, 19, 4}, {2870, 19, 4}, {9115, 14, 4},
+    {6109, 19, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {775, 33, 5}, {0, 0, 0},
+    {22305, 8, 2}, {3364, 25, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1958, 28, 4}, {6761, 18, 4}, {0, 0, 0}, {0, 0, 0}, {3725, 24, 4}, {10967, 13, 2},
+    {7866, 16, 2}, {0, 0, 0}, {29585, 4, 3}, {7594, 16, 5}, {3114, 25, 5}, {0, 0, 0},
+    {3064, 25, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {3984, 23, 5}, {0, 0, 0}, {1874, 28, 5}, {18558, 9, 4}, {321, 7, 4}, {6563, 18, 5},
+    {3687, 14, 4}, {0, 0, 0}, {5919, 19, 4}, {5559, 20, 5}, {5416, 21, 2}, {2338, 27, 4},
+    {364, 36, 4}, {8358, 15, 4}, {0, 0, 0}, {23549, 7, 4}, {1987, 4, 2}, {0, 0, 0},
+    {4840, 22, 4}, {1652, 23, 4}, {16538, 10, 4}, {19032, 3, 2}, {4626, 16, 4}, {0, 0, 0},
+    {3214, 25, 5}, {0, 0, 0}, {0, 0, 0}, {6147, 19, 4}, {2473, 27, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {328, 36, 5}, {0, 0, 0}, {9045, 14, 4}, {16498, 10, 4},
+    {0, 0, 0}, {9059, 14, 4}, {506, 35, 4}, {609, 34, 4}, {1986, 28, 2}, {0, 0, 0},
+    {21177, 8, 4}, {0, 0, 0}, {1902, 28, 5}, {0, 0, 0}, {10505, 7, 4}, {0, 0, 0},
+    {21161, 8, 4}, {5976, 19, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7154, 17, 5}, {0, 0, 0}, {212, 40, 5}, {2889, 25, 5},
+    {0, 0, 0}, {252, 38, 5}, {0, 0, 0}, {5927, 11, 4}, {5699, 20, 4}, {12240, 12, 2},
+    {8688, 15, 2}, {0, 0, 0}, {3653, 24, 4}, {0, 0, 0}, {0, 0, 0}, {2630, 26, 4},
+    {7256, 17, 4}, {18428, 10, 2}, {0, 0, 0}, {0, 0, 0}, {7658, 16, 5}, {11214, 13, 2},
+    {7120, 17, 5}, {2419, 27, 4}, {6185, 19, 5}, {0, 0, 0}, {2682, 26, 2}, {4488, 22, 4},
+    {7171, 17, 5}, {0, 0, 0}, {313, 15, 5}, {25877, 6, 5}, {0, 0, 0}, {949, 24, 4},
+    {10642, 13, 4}, {0, 0, 0}, {6204, 19, 4}, {10733, 13, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5799, 20, 2}, {3239, 25, 5}, {0, 0, 0}, {3389, 24, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25895, 6, 5}, {0, 0, 0},
+    {3264, 25, 4}, {25853, 6, 5}, {9129, 14, 4}, {0, 0, 0}, {676, 33, 5}, {7341, 17, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9311, 14, 2},
+    {0, 0, 0}, {0, 0, 0}, {10564, 13, 4}, {8202, 10, 2}, {8074, 7, 2}, {0, 0, 0},
+    {10486, 13, 5}, {5579, 20, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2526, 26, 5},
+    {0, 0, 0}, {7674, 16, 5}, {0, 0, 0}, {1226, 31, 4}, {0, 0, 0}, {2095, 27, 5},
+    {4065, 3, 5}, {12012, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7375, 17, 2},
+    {5444, 14, 2}, {3557, 24, 5}, {3915, 23, 5}, {3509, 24, 5}, {0, 0, 0}, {0, 0, 0},
+    {16488, 10, 4}, {9087, 14, 4}, {0, 0, 0}, {5143, 21, 4}, {12204, 12, 2}, {1790, 28, 5},
+    {86, 42, 5}, {7690, 16, 5}, {10473, 13, 5}, {14015, 11, 5}, {0, 0, 0}, {0, 0, 0},
+    {2014, 27, 4}, {17118, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {3725, 13, 4}, {4902, 4, 2}, {8418, 15, 2}, {11796, 4, 5}, {0, 0, 0}, {3605, 24, 5},
+    {1318, 30, 5}, {0, 0, 0}, {0, 0, 0}, {5080, 21, 5}, {0, 0, 0}, {5466, 7, 2},
+    {2257, 27, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8538, 15, 2},
+    {11988, 12, 2}, {9437, 14, 2}, {1582, 6, 4}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {21889, 3, 3}, {0, 0, 0}, {0, 0, 0}, {18531, 9, 4}, {0, 0, 0},
+    {3413, 24, 5}, {0, 0, 0}, {0, 0, 0}, {7946, 16, 2}, {3581, 24, 5}, {0, 0, 0},
+    {6977, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4532, 22, 5},
+    {2989, 25, 5}, {0, 0, 0}, {0, 0, 0}, {1414, 24, 4}, {0, 0, 0}, {2230, 27, 5},
+    {7834, 16, 2}, {1824, 12, 4}, {6020, 13, 4}, {6090, 19, 5}, {4053, 23, 5}, {0, 0, 0},
+    {18723, 6, 2}, {14059, 11, 4}, {0, 0, 0}, {7642, 16, 5}, {10538, 13, 4}, {14081, 11, 4},
+    {4122, 23, 4}, {1760, 2, 3}, {8074, 16, 2}, {8328, 15, 5}, {3732, 6, 4}, {0, 0, 0},
+    {11019, 13, 2}, {5859, 20, 2}, {9017, 14, 5}, {0, 0, 0}, {1037, 32, 5}, {0, 0, 0},
+    {4036, 17, 4}, {8339, 4, 5}, {0, 0, 0}, {0, 0, 0}, {12, 2, 3}, {5519, 20, 5},
+    {8493, 15, 2}, {3089, 25, 5}, {3437, 24, 5}, {4906, 22, 2}, {2939, 25, 5}, {7188, 17, 5},
+    {4642, 22, 5}, {0, 0, 0}, {18927, 9, 2}, {6545, 18, 5}, {0, 0, 0}, {4620, 22, 5},
+    {23535, 7, 4}, {0, 0, 0}, {471, 35, 4}, {0, 0, 0}, {7786, 16, 4}, {6014, 19, 5},
+    {0, 0, 0}, {0, 0, 0}, {3014, 25, 5}, {3139, 25, 5}, {0, 0, 0}, {17428, 10, 2},
+    {16871, 7, 2}, {4168, 23, 4}, {0, 0, 0}, {0, 0, 0}, {25847, 6, 4}, {0, 0, 0},
+    {0, 0, 0}, {2473, 3, 2}, {0, 0, 0}, {0, 0, 0}, {2656, 7, 2}, {0, 0, 0},
+    {12516, 12, 2}, {5466, 13, 2}, {5332, 21, 2}, {0, 0, 0}, {814, 13, 4}, {0, 0, 0},
+    {10603, 13, 4}, {0, 0, 0}, {4405, 16, 2}, {0, 0, 0}, {128, 42, 5}, {0, 0, 0},
+    {4730, 22, 5}, {0, 0, 0}, {14400, 11, 2}, {0, 0, 0}, {0, 0, 0}, {1930, 28, 4},
+    {0, 0, 0}, {43, 43, 5}, {21529, 8, 2}, {0, 0, 0}, {1846, 28, 5}, {4237, 23, 2},
+    {0, 0, 0}, {6280, 19, 4}, {550, 7, 4}, {9325, 14, 2}, {0, 0, 0}, {10629, 13, 4},
+    {4576, 22, 5}, {3339, 25, 4}, {2675, 7, 2}, {4510, 22, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {9269, 14, 2}, {0, 0, 0}, {7085, 18, 2}, {0, 0, 0}, {1164, 31, 5},
+    {0, 0, 0}, {0, 0, 0}, {7626, 16, 5}, {0, 0, 0}, {1675, 29, 4}, {0, 0, 0},
+    {1504, 24, 4}, {0, 0, 0}, {8343, 15, 4}, {18936, 9, 2}, {0, 43, 5}, {16548, 10, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {10668, 13, 5}, {0, 0, 0}, {6527, 18, 5},
+    {0, 0, 0}, {7653, 5, 5}, {4708, 22, 5}, {814, 27, 4}, {0, 0, 0}, {0, 0, 0},
+    {8553, 15, 2}, {2578, 26, 5}, {5016, 22, 2}, {0, 0, 0}, {0, 0, 0}, {10616, 13, 4},
+    {0, 0, 0}, {0, 0, 0}, {3749, 24, 2}, {5499, 20, 5}, {11964, 12, 2}, {16798, 10, 2},
+    {8106, 16, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4030, 23, 5}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {2500, 13, 5}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {3314, 25, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {742, 33, 5},
+    {0, 0, 0}, {0, 0, 0}, {16528, 10, 4}, {2532, 20, 4}, {23486, 7, 4}, {0, 0, 0},
+    {14125, 11, 2}, {0, 0, 0}, {541, 34, 4}, {3289, 25, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3938, 23, 5}, {0, 0, 0},
+    {0, 0, 0}, {2446, 6, 2}, {0, 0, 0}, {26261, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {29545, 4, 4}, {0, 0, 0}, {7706, 16, 4}, {0, 0, 0}, {0, 0, 0}, {2311, 27, 5},
+    {0, 0, 0}, {8202, 16, 2}, {0, 0, 0}, {12252, 5, 2}, {5059, 13, 5}, {2552, 26, 5},
+    {808, 33, 5}, {0, 0, 0}, {0, 0, 0}, {8778, 15, 2}, {11904, 12, 2}, {4257, 4, 2},
+    {2984, 4, 4}, {10551, 13, 4}, {18495, 9, 4}, {7850, 16, 2}, {21233, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6071, 19, 5},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3164, 12, 5}, {0, 0, 0},
+    {0, 0, 0}, {575, 34, 4}, {1257, 31, 4}, {4444, 14, 4}, {1617, 29, 5}, {0, 0, 0},
+    {4076, 23, 4}, {4214, 23, 2}, {27971, 5, 3}, {0, 0, 0}, {0, 0, 0}, {6671, 18, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14169, 11, 2}, {0, 0, 0}, {400, 36, 4},
+    {6223, 19, 4}, {26285, 6, 2}, {1693, 11, 4}, {19748, 7, 2}, {0, 0, 0}, {5474, 5, 2},
+    {463, 6, 4}, {0, 0, 0}, {16478, 10, 5}, {24865, 7, 2}, {5290, 21, 2}, {0, 0, 0},
+    {10577, 13, 4}, {11874, 6, 2}, {4774, 22, 5}, {1558, 30, 5}, {841, 33, 5}, {0, 0, 0},
+    {0, 0, 0}, {23542, 7, 4}, {4191, 23, 4}, {290, 38, 5}, {4664, 22, 5}, {3324, 7, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14191, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {25871, 6, 5}, {2845, 19, 2}, {4818, 22, 5}, {0, 0, 0}, {0, 0, 0}, {7273, 17, 4},
+    {874, 33, 4}, {0, 0, 0}, {1498, 30, 5}, {6653, 18, 4}, {0, 0, 0}, {12024, 12, 2},
+    {0, 0, 0}, {5044, 15, 4}, {0, 0, 0}, {5227, 21, 5},
+};
+static const quint16 cmakeKeywordsDisplacements[512] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 1, 1,
+    0, 1, 0, 1, 0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 1, 0,
+    0, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    4, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 6, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 7, 1,
+    4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 6, 0, 0,
+    1, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1,
+    0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0,
+    0, 0, 2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 8,
+    0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+    4, 1, 1, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 0, 1, 0,
+    2, 0, 1, 0, 1, 0, 2, 2, 0, 3, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, 0, 9, 0, 1, 0, 1, 0, 0, 3, 0, 0, 3,
+    0, 0, 2, 0, 1, 0, 0, 1, 6, 1, 0, 4, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 1, 1,
+    7, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, 1, 0, 0, 0, 4, 0, 1, 0, 4, 3, 0, 2, 1, 2,
+    0, 0, 0, 0, 2, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 2,
+};
+const KeywordTable cmakeKeywords = { wordPool, cmakeKeywordsEntries, cmakeKeywordsDisplacements, 1024, 512, 43, 2 };
+static const KeywordSlot makeKeywordsEntries[128] = {
+    {8074, 7, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18588, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {24641, 7, 2}, {0, 0, 0}, {22417, 8, 2}, {23377, 7, 1}, {0, 0, 0},
+    {8508, 6, 2}, {0, 0, 0}, {26369, 6, 1}, {24823, 5, 1}, {21289, 4, 1}, {26261, 4, 2},
+    {26957, 6, 1}, {0, 0, 0}, {14262, 5, 1}, {0, 0, 0}, {23591, 7, 1}, {2446, 6, 2},
+    {2005, 3, 1}, {0, 0, 0}, {0, 0, 0}, {21793, 8, 1}, {24165, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {21953, 8, 1}, {6794, 3, 1}, {0, 0, 0}, {28431, 5, 1}, {29146, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {18585, 9, 1}, {0, 0, 0}, {11976, 6, 1}, {0, 0, 0},
+    {0, 0, 0}, {28251, 5, 2}, {306, 2, 1}, {11924, 4, 1}, {2729, 2, 1}, {21273, 8, 1},
+    {1755, 2, 1}, {0, 0, 0}, {25823, 6, 5}, {9903, 5, 3}, {21956, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23629, 4, 1}, {26525, 6, 2},
+    {22257, 8, 2}, {16871, 7, 1}, {28246, 5, 2}, {12340, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2656, 7, 2}, {0, 0, 0}, {1751, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28961, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22129, 8, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23385, 8, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1582, 6, 5}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16908, 10, 1}, {0, 0, 0}, {0, 0, 0}, {26783, 6, 1},
+    {14691, 4, 1}, {2484, 4, 1}, {605, 4, 5}, {0, 0, 0}, {6851, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2001, 2, 1}, {18945, 9, 1}, {0, 0, 0}, {18950, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {19746, 8, 2}, {0, 0, 0}, {29905, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {7556, 6, 1}, {21929, 8, 2},
+};
+static const quint16 makeKeywordsDisplacements[32] = {
+    0, 0, 0, 3, 1, 0, 1, 1, 1, 0, 0, 0, 2, 1, 0, 0,
+    1, 2, 0, 0, 0, 0, 0, 0, 2, 5, 4, 0, 0, 0, 0, 0,
+};
+const KeywordTable makeKeywords = { wordPool, makeKeywordsEntries, makeKeywordsDisplacements, 128, 32, 10, 0 };
+static const KeywordSlot asmKeywordsEntries[4096] = {
+    {0, 0, 0}, {26477, 6, 2}, {26837, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {5830, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27815, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {26045, 6, 2}, {0, 0, 0}, {25342, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {24431, 7, 2}, {0, 0, 0}, {20961, 9, 2}, {15610, 11, 2}, {0, 0, 0},
+    {9689, 4, 2}, {26033, 3, 2}, {30489, 3, 1}, {19836, 9, 2}, {20394, 9, 2}, {30141, 4, 2},
+    {17688, 10, 2}, {30101, 4, 1}, {0, 0, 0}, {28816, 5, 1}, {27846, 5, 2}, {17718, 10, 2},
+    {0, 0, 0}, {30061, 4, 1}, {15874, 11, 2}, {0, 0, 0}, {20268, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {22769, 8, 2}, {0, 0, 0}, {22849, 8, 2}, {23178, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21401, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27749, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {20368, 8, 2}, {15258, 11, 2}, {0, 0, 0}, {22818, 7, 2}, {0, 0, 0},
+    {28261, 5, 2}, {0, 0, 0}, {20855, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11513, 13, 2}, {17818, 10, 2}, {0, 0, 0}, {28396, 5, 2}, {25097, 6, 2}, {18388, 10, 2},
+    {13308, 12, 2}, {23114, 7, 2}, {30623, 3, 1}, {13416, 12, 2}, {0, 0, 0}, {0, 0, 0},
+    {26309, 4, 2}, {10025, 14, 2}, {22466, 7, 2}, {0, 0, 0}, {23314, 7, 2}, {26363, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {13476, 12, 2}, {0, 0, 0}, {18108, 10, 2}, {29231, 5, 1},
+    {20754, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30695, 3, 1}, {0, 0, 0}, {28297, 4, 2}, {19810, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {27065, 5, 2}, {26147, 6, 2}, {0, 0, 0}, {6813, 2, 1}, {13272, 12, 2},
+    {29793, 4, 2}, {0, 0, 0}, {25411, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {26657, 6, 2}, {15863, 11, 2}, {0, 0, 0}, {19872, 9, 2}, {26651, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16358, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {15555, 11, 2}, {15929, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20359, 7, 2}, {27480, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {12960, 12, 2}, {0, 0, 0}, {0, 0, 0}, {25502, 7, 2},
+    {29326, 5, 1}, {0, 0, 0}, {27882, 5, 2}, {0, 0, 0}, {22193, 3, 2}, {10445, 14, 2},
+    {22762, 4, 2}, {20791, 8, 2}, {0, 0, 0}, {0, 0, 0}, {13500, 12, 2}, {27564, 5, 2},
+    {12828, 12, 2}, {20098, 8, 2}, {0, 0, 0}, {0, 0, 0}, {306, 2, 2}, {0, 0, 0},
+    {26189, 6, 2}, {27485, 6, 2}, {0, 0, 0}, {0, 0, 0}, {27413, 6, 2}, {0, 0, 0},
+    {27883, 4, 2}, {0, 0, 0}, {28616, 5, 2}, {23113, 8, 2}, {25726, 7, 2}, {22689, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {10417, 14, 2}, {25460, 7, 2}, {0, 0, 0}, {23194, 7, 2},
+    {22929, 8, 2}, {25174, 6, 2}, {0, 0, 0}, {0, 0, 0}, {21785, 8, 2}, {25355, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {20025, 9, 2}, {23273, 8, 2}, {25572, 7, 2}, {27551, 6, 2}, {25607, 7, 2}, {0, 0, 0},
+    {15698, 11, 2}, {0, 0, 0}, {22473, 8, 2}, {29531, 5, 1}, {0, 0, 0}, {10249, 14, 2},
+    {0, 0, 0}, {0, 0, 0}, {26135, 6, 2}, {25441, 5, 2}, {30461, 3, 1}, {0, 0, 0},
+    {27443, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29685, 3, 2}, {0, 0, 0},
+    {30599, 3, 1}, {20448, 9, 2}, {0, 0, 0}, {15899, 8, 2}, {27653, 6, 2}, {22953, 8, 2},
+    {30647, 2, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29426, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {22794, 7, 2}, {15313, 11, 2}, {14104, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {4395, 4, 1}, {26507, 6, 2}, {0, 0, 0}, {0, 0, 0}, {24424, 7, 2}, {20404, 8, 2},
+    {0, 0, 0}, {27353, 6, 2}, {0, 0, 0}, {18268, 10, 2}, {25082, 7, 2}, {0, 0, 0},
+    {13260, 12, 2}, {13608, 12, 2}, {21769, 8, 2}, {0, 0, 0}, {0, 0, 0}, {30809, 2, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29781, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28476, 5, 2}, {27371, 6, 2}, {14840, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {21077, 2, 1}, {30795, 2, 1}, {0, 0, 0}, {30409, 3, 2}, {30680, 3, 1},
+    {0, 0, 0}, {18200, 8, 2}, {17868, 10, 2}, {0, 0, 0}, {25629, 5, 2}, {29111, 5, 2},
+    {30073, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {13632, 12, 2}, {20980, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {14983, 11, 2}, {0, 0, 0}, {8170, 4, 2}, {0, 0, 0},
+    {20062, 8, 2}, {22841, 8, 2}, {0, 0, 0}, {0, 0, 0}, {27077, 5, 2}, {11461, 13, 2},
+    {0, 0, 0}, {23025, 8, 2}, {27239, 6, 2}, {0, 0, 0}, {0, 0, 0}, {30515, 3, 2},
+    {22273, 8, 2}, {0, 0, 0}, {27737, 6, 2}, {0, 0, 0}, {27377, 6, 2}, {0, 0, 0},
+    {20592, 9, 2}, {0, 0, 0}, {0, 0, 0}, {25271, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16337, 10, 2}, {29511, 5, 1}, {28966, 5, 2}, {13752, 12, 2},
+    {0, 0, 0}, {0, 0, 0}, {25706, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23409, 8, 2}, {14829, 11, 2}, {5845, 3, 1}, {30069, 4, 1}, {22850, 7, 2},
+    {22474, 7, 2}, {28831, 5, 2}, {0, 0, 0}, {0, 0, 0}, {22458, 7, 2}, {0, 0, 0},
+    {19908, 9, 2}, {20826, 9, 2}, {18138, 10, 2}, {29236, 5, 1}, {13596, 12, 2}, {0, 0, 0},
+    {23363, 6, 2}, {12852, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22001, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25145, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29922, 2, 1}, {20340, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29481, 5, 1},
+    {13728, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {25321, 4, 2}, {17958, 10, 2}, {0, 0, 0}, {29617, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25376, 7, 2}, {25110, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {26987, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2678, 2, 2}, {22777, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {29426, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28491, 5, 2}, {25068, 7, 2}, {14961, 11, 2}, {0, 0, 0}, {22585, 8, 2}, {20187, 9, 2},
+    {20817, 9, 2}, {9955, 14, 2}, {28176, 5, 2}, {25040, 7, 2}, {30773, 3, 1}, {10053, 14, 2},
+    {30452, 3, 2}, {28916, 4, 2}, {0, 0, 0}, {0, 0, 0}, {7533, 2, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25664, 6, 2},
+    {0, 0, 0}, {11748, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {20008, 8, 2}, {0, 0, 0}, {20520, 9, 2}, {14895, 11, 2}, {25524, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {20296, 8, 2}, {0, 0, 0}, {20637, 9, 2}, {22937, 8, 2}, {0, 0, 0},
+    {29877, 2, 2}, {0, 0, 0}, {27791, 6, 2}, {25369, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20016, 9, 2}, {0, 0, 0},
+    {24053, 7, 2}, {27557, 6, 2}, {28776, 4, 2}, {0, 0, 0}, {29885, 3, 2}, {26340, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20574, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {30521, 3, 2}, {0, 0, 0}, {30261, 4, 2}, {15478, 11, 2},
+    {7958, 3, 1}, {0, 0, 0}, {0, 0, 0}, {22657, 8, 2}, {10109, 14, 2}, {0, 0, 0},
+    {28071, 5, 2}, {0, 0, 0}, {29431, 5, 1}, {20349, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21985, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {26375, 6, 2}, {28826, 5, 2}, {7059, 3, 2}, {0, 0, 0}, {25201, 7, 2}, {27359, 6, 2},
+    {0, 0, 0}, {18248, 10, 2}, {25061, 7, 2}, {0, 0, 0}, {0, 0, 0}, {25488, 7, 2},
+    {29156, 5, 2}, {0, 0, 0}, {0, 0, 0}, {19050, 2, 1}, {6423, 2, 1}, {29361, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {29649, 4, 2}, {0, 0, 0}, {0, 0, 0}, {29421, 5, 1},
+    {0, 0, 0}, {19045, 8, 2}, {0, 0, 0}, {22570, 7, 2}, {30554, 3, 2}, {0, 0, 0},
+    {14851, 11, 2}, {11318, 13, 2}, {4329, 4, 2}, {21662, 3, 2}, {0, 0, 0}, {30293, 4, 2},
+    {18068, 10, 2}, {13884, 12, 2}, {27798, 5, 2}, {30105, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {13620, 12, 2}, {0, 0, 0}, {15060, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {24760, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15137, 11, 2},
+    {13404, 12, 2}, {0, 0, 0}, {25306, 7, 2}, {0, 0, 0}, {6979, 3, 2}, {13452, 12, 2},
+    {0, 0, 0}, {0, 0, 0}, {28091, 5, 2}, {0, 0, 0}, {0, 0, 0}, {17778, 10, 2},
+    {18019, 9, 2}, {10193, 14, 2}, {16171, 11, 2}, {0, 0, 0}, {28071, 4, 2}, {26987, 5, 2},
+    {23049, 7, 2}, {0, 0, 0}, {30318, 3, 1}, {30752, 3, 1}, {0, 0, 0}, {26141, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {13236, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20700, 9, 2}, {0, 0, 0}, {30053, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {24620, 7, 2}, {29191, 4, 2}, {12780, 12, 2}, {20232, 9, 2}, {0, 0, 0},
+    {18038, 10, 2}, {0, 0, 0}, {22646, 2, 1}, {30698, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {23050, 6, 2}, {29241, 5, 1}, {0, 0, 0}, {0, 0, 0}, {18249, 9, 2}, {30437, 3, 2},
+    {0, 0, 0}, {29885, 4, 2}, {0, 0, 0}, {27401, 6, 2}, {30545, 3, 2}, {26375, 3, 2},
+    {0, 0, 0}, {25159, 7, 2}, {22630, 3, 1}, {19044, 7, 2}, {22985, 8, 2}, {0, 0, 0},
+    {29121, 5, 2}, {0, 0, 0}, {14532, 9, 2}, {0, 0, 0}, {23731, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {13200, 12, 2}, {29825, 4, 2}, {28356, 4, 2}, {25250, 7, 2}, {27822, 5, 2},
+    {25299, 7, 2}, {26489, 6, 2}, {0, 0, 0}, {22762, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {20529, 9, 2}, {0, 0, 0}, {13572, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28461, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21328, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {20844, 9, 2}, {0, 0, 0}, {15599, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {25649, 7, 2}, {19962, 9, 2}, {0, 0, 0}, {30353, 4, 1}, {30005, 4, 1},
+    {0, 0, 0}, {28081, 4, 2}, {0, 0, 0}, {0, 0, 0}, {22562, 7, 2}, {9997, 14, 2},
+    {27354, 5, 2}, {26219, 3, 2}, {29961, 4, 2}, {20755, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {30557, 3, 2}, {0, 0, 0}, {13824, 12, 2}, {28341, 5, 2}, {22906, 7, 2}, {29865, 4, 2},
+    {10375, 14, 2}, {29011, 5, 2}, {27510, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29391, 5, 1},
+    {28086, 5, 2}, {0, 0, 0}, {28266, 4, 2}, {29456, 5, 1}, {29705, 4, 2}, {25467, 7, 2},
+    {23706, 2, 1}, {18168, 10, 2}, {25593, 7, 2}, {17748, 10, 2}, {20305, 6, 2}, {0, 0, 0},
+    {20556, 9, 2}, {20808, 9, 2}, {22553, 8, 2}, {13116, 12, 2}, {0, 0, 0}, {0, 0, 0},
+    {15500, 11, 2}, {0, 0, 0}, {27479, 6, 2}, {0, 0, 0}, {20449, 8, 2}, {27545, 6, 2},
+    {30617, 3, 1}, {10333, 14, 2}, {15676, 11, 2}, {22465, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {28561, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11604, 13, 2}, {21577, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24992, 6, 2}, {23329, 8, 2}, {0, 0, 0},
+    {29665, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30665, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {10305, 14, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29516, 5, 1}, {0, 0, 0}, {0, 0, 0}, {27803, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {23983, 7, 2}, {0, 0, 0}, {12768, 12, 2}, {30321, 4, 1}, {28191, 5, 2}, {29609, 4, 2},
+    {0, 0, 0}, {30428, 3, 2}, {0, 0, 0}, {26327, 5, 2}, {0, 0, 0}, {18258, 10, 2},
+    {23177, 8, 2}, {0, 0, 0}, {0, 0, 0}, {7870, 3, 2}, {0, 0, 0}, {13188, 12, 2},
+    {0, 0, 0}, {30805, 2, 1}, {23161, 8, 2}, {28906, 5, 2}, {28581, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {17413, 4, 2}, {0, 0, 0}, {27329, 6, 2}, {0, 0, 0},
+    {19828, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18288, 10, 2}, {11409, 13, 2},
+    {30165, 4, 2}, {30009, 3, 1}, {25033, 7, 2}, {0, 0, 0}, {30455, 3, 2}, {0, 0, 0},
+    {27816, 5, 2}, {30121, 4, 2}, {30045, 4, 1}, {0, 0, 0}, {25537, 7, 2}, {25250, 6, 2},
+    {20124, 9, 2}, {27498, 5, 2}, {15027, 11, 2}, {0, 0, 0}, {15005, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23920, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {28911, 5, 2}, {0, 0, 0}, {19998, 9, 2}, {13440, 12, 2}, {0, 0, 0}, {20322, 9, 2},
+    {0, 0, 0}, {30310, 3, 1}, {0, 0, 0}, {0, 0, 0}, {27821, 6, 2}, {13152, 12, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23065, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {2717, 3, 2}, {0, 0, 0}, {0, 0, 0}, {27335, 6, 2},
+    {19548, 9, 2}, {0, 0, 0}, {0, 0, 0}, {30602, 3, 1}, {30357, 4, 1}, {20709, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16248, 11, 2}, {0, 0, 0},
+    {26033, 6, 2}, {0, 0, 0}, {0, 0, 0}, {29897, 3, 2}, {17779, 9, 2}, {0, 0, 0},
+    {30161, 4, 2}, {30305, 4, 1}, {19881, 9, 2}, {0, 0, 0}, {0, 0, 0}, {29286, 5, 1},
+    {0, 0, 0}, {23162, 7, 2}, {22665, 8, 2}, {0, 0, 0}, {0, 0, 0}, {29191, 5, 2},
+    {0, 0, 0}, {23298, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20358, 9, 2}, {26357, 6, 2}, {19819, 8, 2}, {20475, 9, 2}, {28671, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25545, 6, 2}, {26909, 5, 2}, {0, 0, 0},
+    {29701, 4, 2}, {0, 0, 0}, {0, 0, 0}, {27701, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25747, 7, 2}, {0, 0, 0}, {13248, 12, 2}, {30704, 3, 1}, {26579, 6, 2},
+    {0, 0, 0}, {22881, 8, 2}, {27497, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25090, 6, 2}, {23241, 8, 2}, {0, 0, 0},
+    {30464, 3, 1}, {29713, 4, 2}, {23361, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18178, 10, 2}, {0, 0, 0}, {17708, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {21593, 8, 2}, {28161, 5, 2}, {0, 0, 0}, {16281, 11, 2},
+    {18204, 4, 2}, {0, 0, 0}, {25385, 5, 2}, {0, 0, 0}, {0, 0, 0}, {29311, 5, 2},
+    {28547, 3, 1}, {20089, 8, 2}, {0, 0, 0}, {17758, 10, 2}, {30793, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22882, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {20254, 5, 2}, {0, 0, 0}, {28621, 5, 2}, {23433, 8, 2}, {13788, 12, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26435, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {22921, 8, 2}, {25146, 6, 2}, {30473, 3, 1}, {0, 0, 0}, {0, 0, 0}, {25442, 4, 2},
+    {22529, 8, 2}, {25699, 6, 2}, {30797, 2, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25565, 7, 2}, {28551, 5, 2}, {0, 0, 0}, {13104, 12, 2},
+    {0, 0, 0}, {13344, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {13044, 12, 2}, {0, 0, 0}, {11591, 13, 2}, {25335, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {30551, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23233, 8, 2}, {0, 0, 0}, {21577, 7, 2}, {20359, 8, 2}, {0, 0, 0},
+    {20773, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29461, 5, 1}, {0, 0, 0},
+    {11539, 13, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29506, 5, 1}, {30611, 3, 1}, {20395, 8, 2},
+    {20988, 9, 2}, {16199, 5, 2}, {0, 0, 0}, {0, 0, 0}, {25075, 7, 2}, {0, 0, 0},
+    {24221, 7, 2}, {0, 0, 0}, {28862, 4, 2}, {23731, 7, 2}, {0, 0, 0}, {4215, 2, 1},
+    {23169, 8, 2}, {0, 0, 0}, {8152, 3, 2}, {0, 0, 0}, {11734, 13, 2}, {28766, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {27311, 6, 2}, {19981, 8, 2}, {20917, 5, 2}, {13908, 12, 2},
+    {30377, 4, 1}, {18801, 9, 2}, {30710, 3, 1}, {28111, 5, 2}, {10991, 3, 1}, {30671, 3, 1},
+    {16072, 11, 2}, {0, 0, 0}, {0, 0, 0}, {17918, 10, 2}, {27768, 5, 2}, {0, 0, 0},
+    {30085, 4, 1}, {0, 0, 0}, {25544, 7, 2}, {0, 0, 0}, {0, 0, 0}, {27425, 6, 2},
+    {23075, 5, 2}, {0, 0, 0}, {0, 0, 0}, {25608, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {22833, 8, 2}, {11422, 13, 2}, {11747, 13, 2}, {0, 0, 0},
+    {23057, 8, 2}, {20310, 3, 1}, {13692, 12, 2}, {0, 0, 0}, {30635, 3, 1}, {20916, 9, 2},
+    {28166, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {22897, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28596, 5, 2}, {30629, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28406, 5, 2}, {0, 0, 0}, {21096, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {16188, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29366, 5, 1}, {30659, 3, 1},
+    {0, 0, 0}, {24200, 6, 2}, {16413, 11, 2}, {0, 0, 0}, {23170, 7, 2}, {0, 0, 0},
+    {22673, 8, 2}, {0, 0, 0}, {15984, 11, 2}, {18398, 10, 2}, {29117, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {26417, 6, 2}, {0, 0, 0}, {20322, 7, 2}, {0, 0, 0}, {15302, 11, 2},
+    {0, 0, 0}, {30181, 4, 2}, {25250, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23928, 6, 2}, {0, 0, 0}, {17908, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {25663, 7, 2}, {0, 0, 0}, {0, 0, 0}, {22545, 8, 2}, {0, 0, 0}, {12900, 12, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15566, 11, 2},
+    {0, 0, 0}, {24039, 6, 2}, {30410, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23362, 7, 2}, {29261, 5, 1}, {0, 0, 0}, {20890, 8, 2}, {20628, 9, 2}, {10207, 14, 2},
+    {23920, 6, 2}, {0, 0, 0}, {20125, 8, 2}, {20682, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {12696, 12, 2}, {15995, 11, 2}, {0, 0, 0}, {22601, 8, 2}, {30041, 4, 1},
+    {22578, 7, 2}, {12756, 12, 2}, {30674, 3, 1}, {0, 0, 0}, {27504, 5, 2}, {23209, 8, 2},
+    {0, 0, 0}, {18208, 10, 2}, {0, 0, 0}, {0, 0, 0}, {20853, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {25468, 6, 2}, {0, 0, 0}, {16160, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {28501, 5, 2}, {24592, 7, 2}, {0, 0, 0}, {30563, 3, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8804, 4, 1}, {29356, 5, 1},
+    {22490, 7, 2}, {0, 0, 0}, {0, 0, 0}, {20646, 9, 2}, {22945, 8, 2}, {26747, 6, 2},
+    {17798, 10, 2}, {0, 0, 0}, {13848, 12, 2}, {23058, 7, 2}, {29973, 4, 2}, {0, 0, 0},
+    {30746, 3, 1}, {0, 0, 0}, {19764, 9, 2}, {0, 0, 0}, {0, 0, 0}, {22155, 6, 1},
+    {26298, 5, 2}, {29197, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15269, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {14532, 11, 2}, {0, 0, 0}, {21593, 6, 2}, {21409, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {25495, 7, 2}, {0, 0, 0}, {29897, 4, 2}, {22537, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22577, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19999, 8, 2}, {0, 0, 0},
+    {4364, 2, 1}, {0, 0, 0}, {29526, 5, 1}, {10815, 4, 4}, {0, 0, 0}, {26723, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {30314, 3, 1}, {21993, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {8928, 15, 2}, {0, 0, 0}, {0, 0, 0}, {30089, 4, 2},
+    {13812, 12, 2}, {18238, 10, 2}, {23017, 8, 2}, {0, 0, 0}, {30404, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {16369, 11, 2}, {20295, 9, 2}, {21316, 2, 1}, {28591, 5, 2}, {18448, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26489, 5, 2}, {30671, 2, 1}, {17518, 10, 2},
+    {15346, 11, 2}, {19990, 8, 2}, {0, 0, 0}, {0, 0, 0}, {10263, 14, 2}, {0, 0, 0},
+    {18308, 10, 2}, {11331, 13, 2}, {27929, 6, 2}, {30041, 3, 1}, {29921, 4, 2}, {0, 0, 0},
+    {17859, 9, 2}, {22761, 8, 2}, {15181, 11, 2}, {29336, 5, 1}, {30029, 4, 1}, {26429, 6, 2},
+    {0, 0, 0}, {20997, 9, 2}, {17368, 10, 2}, {20998, 8, 2}, {15049, 11, 2}, {20044, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {30626, 3, 1}, {30686, 3, 1}, {23185, 8, 2}, {15126, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {28926, 5, 2}, {25377, 6, 2}, {0, 0, 0}, {22033, 8, 2},
+    {0, 0, 0}, {28781, 5, 2}, {0, 0, 0}, {27839, 6, 2}, {0, 0, 0}, {16227, 10, 2},
+    {24025, 4, 2}, {0, 0, 0}, {30225, 4, 2}, {27366, 5, 2}, {0, 0, 0}, {11578, 13, 2},
+    {22826, 7, 2}, {0, 0, 0}, {29056, 5, 2}, {0, 0, 0}, {30701, 3, 1}, {0, 0, 0},
+    {17568, 4, 2}, {15423, 11, 2}, {28312, 4, 2}, {22602, 7, 2}, {13536, 12, 2}, {30491, 3, 1},
+    {0, 0, 0}, {20718, 9, 2}, {30590, 3, 1}, {0, 0, 0}, {20061, 9, 2}, {0, 0, 0},
+    {28301, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23661, 7, 2}, {7395, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {30197, 4, 2}, {17348, 10, 2}, {22638, 3, 1}, {0, 0, 0},
+    {18118, 10, 2}, {29296, 5, 1}, {20763, 9, 2}, {15434, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {19032, 3, 2}, {20565, 9, 2}, {29196, 4, 1}, {8709, 4, 4}, {27725, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {25404, 7, 2}, {0, 0, 0}, {15291, 11, 2}, {0, 0, 0}, {13008, 12, 2},
+    {20304, 5, 2}, {0, 0, 0}, {26483, 6, 2}, {0, 0, 0}, {26177, 6, 2}, {23041, 8, 2},
+    {28436, 5, 2}, {0, 0, 0}, {29829, 4, 2}, {29801, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28721, 5, 2}, {0, 0, 0}, {26651, 6, 2}, {30587, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {29629, 4, 2}, {0, 0, 0}, {25139, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28861, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {19926, 9, 2}, {0, 0, 0}, {25538, 6, 2}, {22817, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {25398, 6, 2}, {23097, 8, 2}, {22609, 8, 2}, {0, 0, 0}, {13092, 12, 2}, {29471, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {26423, 6, 2}, {0, 0, 0}, {27408, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {13716, 12, 2}, {20871, 9, 2}, {0, 0, 0}, {15962, 11, 2}, {23025, 7, 2},
+    {0, 0, 0}, {28996, 5, 2}, {20367, 9, 2}, {10081, 14, 2}, {0, 0, 0}, {29997, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {19272, 2, 1}, {0, 0, 0}, {22913, 8, 2}, {25096, 7, 2},
+    {0, 0, 0}, {14388, 3, 1}, {27491, 6, 2}, {0, 0, 0}, {0, 0, 0}, {25481, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {27581, 6, 2}, {28266, 5, 2}, {22890, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {25435, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25789, 7, 2},
+    {0, 0, 0}, {21069, 9, 2}, {0, 0, 0}, {0, 0, 0}, {25579, 7, 2}, {25243, 7, 2},
+    {15841, 11, 2}, {14521, 11, 2}, {26309, 5, 2}, {15236, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {22273, 3, 2}, {0, 0, 0}, {0, 0, 0}, {27786, 5, 2}, {30719, 3, 1}, {0, 0, 0},
+    {29271, 5, 1}, {10165, 14, 2}, {29881, 4, 2}, {30740, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {27233, 6, 2}, {29993, 4, 1}, {0, 0, 0}, {26909, 6, 2}, {30605, 3, 1}, {0, 0, 0},
+    {28201, 5, 2}, {0, 0, 0}, {22866, 7, 2}, {0, 0, 0}, {0, 0, 0}, {25412, 6, 2},
+    {29451, 5, 1}, {0, 0, 0}, {20881, 8, 2}, {18179, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {14994, 11, 2}, {0, 0, 0}, {30109, 4, 1}, {0, 0, 0},
+    {25012, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18278, 10, 2},
+    {25341, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30117, 4, 2}, {30524, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {13920, 12, 2},
+    {27623, 6, 2}, {26039, 6, 2}, {0, 0, 0}, {0, 0, 0}, {27323, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {20133, 9, 2}, {10277, 14, 2}, {19980, 9, 2}, {18318, 10, 2}, {0, 0, 0},
+    {30149, 4, 2}, {8189, 3, 1}, {23010, 6, 2}, {23313, 8, 2}, {0, 0, 0}, {18058, 10, 2},
+    {27762, 5, 2}, {11643, 13, 2}, {0, 0, 0}, {0, 0, 0}, {25523, 7, 2}, {12948, 12, 2},
+    {0, 0, 0}, {20989, 8, 2}, {24543, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {20071, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22617, 8, 2}, {0, 0, 0},
+    {27071, 5, 2}, {26861, 6, 2}, {0, 0, 0}, {15951, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {15038, 11, 2}, {0, 0, 0}, {0, 0, 0}, {15588, 11, 2},
+    {24557, 7, 2}, {20745, 9, 2}, {27947, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30467, 3, 1}, {0, 0, 0}, {26447, 5, 2}, {0, 0, 0}, {0, 0, 0}, {15412, 11, 2},
+    {11435, 13, 2}, {29316, 4, 1}, {30527, 3, 2}, {20007, 9, 2}, {11383, 13, 2}, {20727, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29416, 4, 1}, {0, 0, 0},
+    {16721, 4, 2}, {12708, 12, 2}, {0, 0, 0}, {0, 0, 0}, {1998, 3, 1}, {0, 0, 0},
+    {13224, 12, 2}, {28096, 5, 2}, {18639, 9, 2}, {0, 0, 0}, {0, 0, 0}, {29301, 5, 1},
+    {0, 0, 0}, {30389, 4, 1}, {26867, 6, 2}, {0, 0, 0}, {23345, 8, 2}, {0, 0, 0},
+    {17898, 10, 2}, {15753, 11, 2}, {0, 0, 0}, {0, 0, 0}, {13356, 12, 2}, {25194, 7, 2},
+    {26669, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20484, 9, 2}, {27953, 6, 2},
+    {30125, 4, 2}, {0, 0, 0}, {20800, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29833, 4, 2}, {23331, 6, 2}, {20035, 8, 2}, {0, 0, 0}, {18188, 10, 2}, {0, 0, 0},
+    {0, 0, 0}, {26363, 5, 2}, {28311, 5, 2}, {0, 0, 0}, {10361, 14, 2}, {0, 0, 0},
+    {25237, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8072, 3, 2}, {23346, 7, 2}, {0, 0, 0}, {28356, 5, 2}, {15115, 11, 2}, {0, 0, 0},
+    {30551, 3, 2}, {15204, 4, 2}, {30791, 2, 2}, {11669, 13, 2}, {18348, 10, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {13992, 12, 2}, {0, 0, 0}, {0, 0, 0}, {29669, 4, 1},
+    {0, 0, 0}, {20196, 9, 2}, {2694, 3, 2}, {23921, 5, 2}, {30662, 3, 1}, {20178, 9, 2},
+    {0, 0, 0}, {27605, 6, 2}, {27426, 5, 2}, {0, 0, 0}, {0, 0, 0}, {27534, 5, 2},
+    {12876, 12, 2}, {15544, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29501, 5, 1},
+    {26321, 4, 2}, {23066, 6, 2}, {25446, 7, 2}, {22898, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {20799, 9, 2}, {2674, 2, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20026, 8, 2},
+    {8902, 3, 2}, {0, 0, 0}, {0, 0, 0}, {25439, 7, 2}, {27857, 6, 2}, {0, 0, 0},
+    {22889, 8, 2}, {0, 0, 0}, {22729, 8, 2}, {0, 0, 0}, {13872, 12, 2}, {14093, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15665, 11, 2}, {27347, 6, 2}, {6815, 3, 2},
+    {0, 0, 0}, {22865, 8, 2}, {27587, 6, 2}, {23121, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {29116, 5, 2}, {15247, 11, 2}, {0, 0, 0}, {23321, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {9885, 14, 2}, {0, 0, 0}, {28701, 5, 2}, {25328, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4877, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {30265, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28491, 4, 2}, {0, 0, 0},
+    {25251, 5, 2}, {28291, 5, 2}, {0, 0, 0}, {20781, 9, 2}, {29496, 5, 1}, {20691, 9, 2},
+    {20854, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30081, 4, 1},
+    {30527, 2, 2}, {0, 0, 0}, {14830, 10, 2}, {0, 0, 0}, {10067, 14, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {30309, 4, 1}, {0, 0, 0}, {23033, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {20088, 9, 2}, {0, 0, 0}, {27887, 6, 2}, {0, 0, 0}, {2005, 2, 1},
+    {25222, 7, 2}, {13320, 12, 2}, {0, 0, 0}, {30169, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {22969, 8, 2}, {27833, 6, 2}, {19972, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {30449, 3, 2}, {11565, 13, 2}, {0, 0, 0}, {0, 0, 0}, {28438, 3, 1}, {5460, 3, 1},
+    {0, 0, 0}, {13068, 12, 2}, {18078, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30013, 4, 1}, {12912, 12, 2}, {27317, 6, 2}, {26891, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {29779, 3, 2}, {16237, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {13212, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25313, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28786, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {23941, 7, 2}, {0, 0, 0}, {27773, 6, 2}, {0, 0, 0}, {20925, 9, 2}, {8892, 4, 2},
+    {0, 0, 0}, {30482, 3, 1}, {27671, 6, 2}, {0, 0, 0}, {0, 0, 0}, {27863, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15445, 11, 2}, {0, 0, 0}, {30345, 4, 1},
+    {30737, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15709, 11, 2},
+    {20746, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27083, 6, 2}, {0, 0, 0},
+    {20223, 9, 2}, {0, 0, 0}, {4428, 3, 2}, {13164, 12, 2}, {0, 0, 0}, {15632, 11, 2},
+    {30638, 3, 1}, {0, 0, 0}, {22746, 7, 2}, {20256, 3, 4}, {27797, 6, 2}, {30385, 4, 1},
+    {25321, 6, 2}, {30767, 3, 2}, {29937, 4, 2}, {0, 0, 0}, {0, 0, 0}, {20583, 9, 2},
+    {0, 0, 0}, {9546, 2, 1}, {9492, 3, 2}, {20790, 9, 2}, {15071, 11, 2}, {29993, 3, 1},
+    {11719, 2, 1}, {13056, 12, 2}, {20502, 9, 2}, {0, 0, 0}, {0, 0, 0}, {30644, 3, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15819, 11, 2}, {2704, 2, 1}, {29813, 4, 2},
+    {30572, 3, 2}, {0, 0, 0}, {25278, 7, 2}, {26843, 5, 2}, {0, 0, 0}, {22610, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {20538, 9, 2}, {25013, 4, 2}, {23153, 8, 2}, {0, 0, 0},
+    {14917, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28716, 5, 2}, {17989, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {22646, 3, 1}, {28481, 5, 2}, {18148, 10, 2}, {6817, 4, 4},
+    {0, 0, 0}, {0, 0, 0}, {25727, 6, 2}, {0, 0, 0}, {2781, 3, 1}, {0, 0, 0},
+    {13968, 12, 2}, {0, 0, 0}, {29881, 3, 2}, {23089, 8, 2}, {22593, 8, 2}, {15742, 11, 2},
+    {0, 0, 0}, {28156, 5, 2}, {0, 0, 0}, {29321, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {24032, 7, 2}, {0, 0, 0}, {23001, 8, 2}, {30725, 3, 2}, {19101, 3, 1}, {0, 0, 0},
+    {2472, 2, 1}, {18358, 10, 2}, {0, 0, 0}, {29941, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {17998, 10, 2}, {19065, 5, 2}, {0, 0, 0}, {26147, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25425, 7, 2}, {25531, 6, 2}, {18218, 10, 2},
+    {16193, 11, 2}, {27635, 6, 2}, {0, 0, 0}, {30539, 3, 2}, {0, 0, 0}, {24410, 7, 2},
+    {17808, 10, 2}, {0, 0, 0}, {13860, 12, 2}, {0, 0, 0}, {0, 0, 0}, {25698, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {10221, 14, 2}, {19800, 9, 2}, {30337, 4, 1}, {18810, 9, 2},
+    {28401, 5, 2}, {0, 0, 0}, {0, 0, 0}, {20547, 9, 2}, {15687, 11, 2}, {29351, 5, 1},
+    {16347, 11, 2}, {0, 0, 0}, {26315, 6, 2}, {25111, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {11630, 13, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16017, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22730, 7, 2}, {18018, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18198, 10, 2}, {2670, 2, 1}, {29371, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30620, 3, 1}, {20872, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {13932, 12, 2}, {25615, 6, 2}, {27774, 5, 2}, {25348, 7, 2}, {26393, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28891, 5, 2}, {26855, 6, 2}, {1988, 2, 1},
+    {0, 0, 0}, {30000, 3, 1}, {25334, 7, 2}, {0, 0, 0}, {0, 0, 0}, {20106, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {15148, 11, 2}, {15093, 11, 2}, {27840, 5, 2}, {25426, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14950, 11, 2}, {0, 0, 0},
+    {22914, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25601, 6, 2}, {20943, 9, 2},
+    {30761, 3, 1}, {0, 0, 0}, {28966, 4, 2}, {4341, 3, 2}, {20377, 8, 2}, {0, 0, 0},
+    {28081, 5, 2}, {29401, 5, 1}, {27810, 5, 2}, {8154, 4, 1}, {0, 0, 0}, {29446, 5, 1},
+    {16718, 10, 2}, {29151, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27450, 5, 2}, {0, 0, 0}, {0, 0, 0}, {16718, 7, 2}, {24648, 7, 2}, {0, 0, 0},
+    {9900, 3, 2}, {0, 0, 0}, {28941, 5, 2}, {25482, 6, 2}, {27431, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {28776, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21594, 7, 2},
+    {27785, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25685, 6, 2}, {27383, 6, 2}, {0, 0, 0}, {0, 0, 0}, {16094, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30349, 4, 1}, {9197, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27365, 6, 2}, {0, 0, 0}, {0, 0, 0}, {28661, 5, 2},
+    {26399, 6, 2}, {0, 0, 0}, {29296, 4, 1}, {12732, 12, 2}, {25384, 6, 2}, {0, 0, 0},
+    {7555, 3, 2}, {21777, 8, 2}, {27641, 6, 2}, {12618, 2, 2}, {15324, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {14972, 11, 2}, {30381, 4, 1}, {27462, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {26981, 6, 2}, {15522, 11, 2}, {0, 0, 0}, {0, 0, 0}, {30500, 3, 1},
+    {21078, 9, 2}, {25264, 7, 2}, {0, 0, 0}, {22457, 8, 2}, {10459, 14, 2}, {23265, 8, 2},
+    {29126, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {15830, 11, 2}, {9969, 14, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {25292, 7, 2}, {0, 0, 0}, {16270, 11, 2}, {0, 0, 0}, {15885, 11, 2}, {0, 0, 0},
+    {22041, 8, 2}, {0, 0, 0}, {0, 0, 0}, {27503, 6, 2}, {25691, 7, 2}, {13296, 12, 2},
+    {22618, 7, 2}, {0, 0, 0}, {0, 0, 0}, {30596, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {25530, 7, 2}, {27745, 4, 2}, {29685, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {13488, 12, 2}, {25677, 7, 2}, {0, 0, 0}, {8988, 15, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29661, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9913, 14, 2},
+    {0, 0, 0}, {0, 0, 0}, {30057, 3, 1}, {25733, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {27540, 5, 2}, {23604, 3, 2}, {28771, 5, 2}, {30716, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {16204, 11, 2}, {0, 0, 0}, {16424, 11, 2}, {0, 0, 0}, {22858, 7, 2},
+    {0, 0, 0}, {12864, 12, 2}, {20245, 5, 2}, {11448, 13, 2}, {7429, 2, 1}, {0, 0, 0},
+    {0, 0, 0}, {18088, 10, 2}, {0, 0, 0}, {24739, 7, 5}, {20341, 8, 2}, {20169, 9, 2},
+    {0, 0, 0}, {22324, 5, 2}, {0, 0, 0}, {25195, 6, 2}, {0, 0, 0}, {23018, 7, 2},
+    {0, 0, 0}, {17828, 10, 2}, {0, 0, 0}, {2829, 5, 2}, {27509, 6, 2}, {27917, 6, 2},
+    {19818, 9, 2}, {0, 0, 0}, {0, 0, 0}, {24214, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {21425, 8, 2}, {27875, 6, 2}, {0, 0, 0}, {0, 0, 0}, {30025, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {10978, 3, 1}, {6421, 3, 2}, {28271, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {13644, 12, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {17759, 9, 2}, {0, 0, 0}, {11656, 13, 2}, {0, 0, 0}, {0, 0, 0},
+    {25456, 4, 2}, {25642, 7, 2}, {15533, 11, 2}, {26321, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {29466, 5, 1}, {0, 0, 0}, {18418, 10, 2}, {29256, 5, 1}, {28851, 5, 1}, {0, 0, 0},
+    {0, 0, 0}, {25180, 5, 2}, {30470, 3, 1}, {24060, 5, 2}, {0, 0, 0}, {27695, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {13764, 12, 2}, {29777, 4, 2}, {27389, 6, 2},
+    {25320, 7, 2}, {0, 0, 0}, {20161, 8, 2}, {15511, 11, 2}, {15910, 8, 2}, {24032, 5, 2},
+    {0, 0, 0}, {29901, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26021, 6, 2}, {20422, 8, 2}, {30647, 3, 1}, {0, 0, 0}, {18448, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {25586, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29381, 5, 1}, {20898, 9, 2}, {23026, 6, 2}, {0, 0, 0}, {0, 0, 0}, {13668, 12, 2},
+    {17698, 10, 2}, {25160, 6, 2}, {30001, 4, 1}, {16325, 11, 2}, {27827, 5, 2}, {14928, 11, 2},
+    {0, 0, 0}, {27419, 6, 2}, {30413, 3, 2}, {0, 0, 0}, {0, 0, 0}, {25622, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28851, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {28936, 5, 2}, {0, 0, 0}, {23081, 8, 2}, {30302, 3, 1}, {0, 0, 0}, {11617, 13, 2},
+    {0, 0, 0}, {17768, 10, 2}, {0, 0, 0}, {0, 0, 0}, {25663, 6, 2}, {0, 0, 0},
+    {22753, 8, 2}, {0, 0, 0}, {21578, 7, 2}, {0, 0, 0}, {0, 0, 0}, {25712, 7, 2},
+    {0, 0, 0}, {27851, 6, 2}, {28371, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25005, 7, 2}, {0, 0, 0}, {28542, 3, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {18269, 9, 2}, {0, 0, 0}, {22017, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {29612, 4, 2}, {12744, 12, 2}, {20241, 9, 2}, {23137, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {30692, 3, 1}, {0, 0, 0}, {26975, 6, 2}, {20151, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {22449, 8, 2}, {0, 0, 0}, {5764, 3, 2}, {0, 0, 0}, {28746, 5, 2}, {0, 0, 0},
+    {22233, 8, 2}, {26339, 6, 2}, {28736, 5, 2}, {0, 0, 0}, {0, 0, 0}, {25166, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22745, 8, 2}, {0, 0, 0}, {0, 0, 0}, {25978, 3, 2}, {0, 0, 0}, {20971, 8, 2},
+    {0, 0, 0}, {13980, 12, 2}, {25390, 7, 2}, {0, 0, 0}, {18298, 10, 2}, {28731, 5, 2},
+    {0, 0, 0}, {24060, 7, 2}, {0, 0, 0}, {0, 0, 0}, {26597, 6, 2}, {9168, 3, 2},
+    {25244, 6, 2}, {0, 0, 0}, {21985, 5, 2}, {0, 0, 0}, {0, 0, 0}, {23145, 8, 2},
+    {14403, 3, 1}, {18645, 4, 2}, {0, 0, 0}, {0, 0, 0}, {25285, 7, 2}, {25432, 7, 2},
+    {20619, 9, 2}, {0, 0, 0}, {25787, 3, 1}, {0, 0, 0}, {25516, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25454, 6, 2}, {0, 0, 0}, {0, 0, 0}, {29657, 4, 1},
+    {18684, 4, 1}, {15720, 11, 2}, {22586, 7, 2}, {9927, 14, 2}, {6794, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {23217, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27552, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30749, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {20134, 8, 2}, {30713, 3, 1}, {22874, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {27877, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28101, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28116, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22905, 8, 2}, {0, 0, 0}, {29341, 5, 1}, {0, 0, 0}, {0, 0, 0}, {18783, 9, 2},
+    {26465, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30301, 4, 1}, {0, 0, 0},
+    {20034, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {27558, 5, 2}, {18158, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29913, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {26339, 5, 2}, {27518, 3, 2}, {0, 0, 0}, {23921, 6, 2},
+    {0, 0, 0}, {27516, 5, 2}, {28296, 5, 2}, {0, 0, 0}, {20601, 9, 2}, {17128, 10, 2},
+    {19846, 8, 2}, {23129, 8, 2}, {19953, 9, 2}, {27396, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {29889, 3, 2}, {0, 0, 0}, {0, 0, 0}, {29188, 4, 2}, {13332, 12, 2}, {0, 0, 0},
+    {20863, 8, 2}, {0, 0, 0}, {28841, 5, 2}, {25684, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {22801, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22225, 8, 2},
+    {23249, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22273, 5, 2}, {16050, 11, 2},
+    {26135, 5, 2}, {24396, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2658, 2, 1},
+    {13428, 12, 2}, {0, 0, 0}, {26411, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27827, 6, 2}, {14840, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28761, 5, 2}, {29386, 5, 1}, {30677, 3, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {13656, 12, 2}, {0, 0, 0}, {30097, 4, 1},
+    {23401, 8, 2}, {16292, 11, 2}, {0, 0, 0}, {20970, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {26357, 4, 2}, {0, 0, 0}, {0, 0, 0}, {11721, 13, 2}, {13740, 12, 2}, {30407, 3, 2},
+    {25152, 7, 2}, {0, 0, 0}, {30743, 3, 1}, {23139, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {23049, 8, 2}, {19944, 9, 2}, {26141, 5, 2}, {28766, 5, 2}, {0, 0, 0}, {14752, 11, 2},
+    {20756, 5, 2}, {13512, 12, 2}, {27779, 6, 2}, {28446, 5, 2}, {16149, 11, 2}, {25208, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {27665, 6, 2}, {10123, 14, 2}, {28921, 5, 2}, {27869, 6, 2},
+    {0, 0, 0}, {16336, 11, 2}, {0, 0, 0}, {0, 0, 0}, {26621, 6, 2}, {30341, 4, 1},
+    {0, 0, 0}, {19855, 8, 2}, {0, 0, 0}, {27077, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {29803, 2, 1}, {29316, 5, 1}, {25383, 7, 2}, {0, 0, 0},
+    {20250, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29196, 5, 1}, {27521, 6, 2},
+    {19899, 9, 2}, {27600, 5, 2}, {23305, 8, 2}, {29201, 5, 1}, {0, 0, 0}, {30373, 4, 1},
+    {0, 0, 0}, {0, 0, 0}, {28741, 5, 2}, {14841, 10, 2}, {0, 0, 0}, {28686, 5, 2},
+    {22275, 4, 2}, {27569, 6, 2}, {13836, 12, 2}, {25138, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {19854, 9, 2}, {28821, 3, 2}, {20493, 9, 2}, {28186, 5, 2}, {0, 0, 0}, {29486, 5, 1},
+    {21308, 2, 1}, {0, 0, 0}, {20736, 9, 2}, {15808, 11, 2}, {26489, 4, 2}, {29797, 4, 2},
+    {26447, 6, 2}, {13128, 12, 2}, {23355, 6, 2}, {0, 0, 0}, {0, 0, 0}, {28316, 5, 2},
+    {0, 0, 0}, {17968, 10, 2}, {30593, 3, 1}, {0, 0, 0}, {14873, 11, 2}, {29346, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23724, 7, 2},
+    {0, 0, 0}, {30065, 4, 1}, {0, 0, 0}, {0, 0, 0}, {21289, 4, 2}, {22778, 7, 2},
+    {23922, 5, 2}, {26183, 6, 2}, {20116, 8, 2}, {28931, 5, 2}, {0, 0, 0}, {23009, 8, 2},
+    {25440, 6, 2}, {27390, 5, 2}, {0, 0, 0}, {27455, 6, 2}, {27659, 6, 2}, {14708, 3, 2},
+    {16061, 11, 2}, {29376, 5, 1}, {2656, 3, 1}, {29441, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {30257, 3, 2}, {0, 0, 0}, {0, 0, 0}, {28696, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {24578, 7, 2}, {0, 0, 0}, {20466, 9, 2}, {29925, 4, 2}, {20782, 8, 2}, {23186, 7, 2},
+    {28556, 5, 2}, {30488, 3, 1}, {0, 0, 0}, {18448, 5, 2}, {15902, 5, 2}, {8597, 2, 1},
+    {0, 0, 0}, {25089, 7, 2}, {28386, 5, 2}, {26027, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {27611, 6, 2}, {0, 0, 0}, {30057, 4, 1}, {20017, 8, 2}, {20783, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {17999, 9, 2}, {14740, 2, 1}, {28276, 5, 2}, {0, 0, 0},
+    {30758, 3, 1}, {0, 0, 0}, {13956, 12, 2}, {19791, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25236, 7, 2}, {0, 0, 0}, {29406, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {15654, 11, 2}, {20403, 9, 2}, {0, 0, 0}, {26843, 6, 2}, {0, 0, 0}, {20286, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {22795, 6, 2}, {0, 0, 0}, {15489, 11, 2},
+    {28886, 5, 2}, {0, 0, 0}, {10927, 2, 1}, {0, 0, 0}, {22977, 8, 2}, {0, 0, 0},
+    {26333, 5, 2}, {27713, 6, 2}, {29476, 5, 1}, {29893, 3, 2}, {0, 0, 0}, {26405, 6, 2},
+    {28846, 5, 2}, {0, 0, 0}, {30632, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28881, 5, 2}, {28651, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {17938, 10, 2}, {22993, 8, 2}, {21930, 4, 2}, {19935, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {10235, 14, 2}, {0, 0, 0}, {30695, 2, 1}, {0, 0, 0}, {0, 0, 0},
+    {28566, 5, 2}, {22825, 8, 2}, {15082, 11, 2}, {18328, 10, 2}, {25362, 7, 2}, {0, 0, 0},
+    {28281, 5, 2}, {0, 0, 0}, {25047, 7, 2}, {0, 0, 0}, {0, 0, 0}, {18009, 9, 2},
+    {5332, 3, 2}, {0, 0, 0}, {30145, 4, 2}, {30722, 3, 2}, {30608, 3, 1}, {0, 0, 0},
+    {0, 0, 0}, {18048, 10, 2}, {17678, 10, 2}, {27719, 6, 2}, {30049, 4, 1}, {13464, 12, 2},
+    {16728, 10, 2}, {0, 0, 0}, {20899, 8, 2}, {27407, 6, 2}, {30650, 3, 1}, {0, 0, 0},
+    {20907, 9, 2}, {0, 0, 0}, {0, 0, 0}, {20358, 8, 2}, {20079, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {30668, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {24011, 7, 2},
+    {27743, 6, 2}, {0, 0, 0}, {0, 0, 0}, {28066, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {27683, 6, 2}, {0, 0, 0}, {29281, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28346, 5, 2}, {26321, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {19837, 8, 2}, {0, 0, 0}, {30542, 3, 2}, {20070, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {25405, 6, 2}, {30073, 3, 1}, {0, 0, 0}, {26327, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {30799, 2, 1}, {0, 0, 0}, {29141, 5, 2}, {13392, 12, 2}, {0, 0, 0},
+    {29026, 5, 2}, {29206, 5, 1}, {0, 0, 0}, {30369, 4, 1}, {18259, 9, 2}, {30653, 3, 1},
+    {0, 0, 0}, {0, 0, 0}, {29112, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {8913, 15, 2}, {25020, 6, 2}, {0, 0, 0}, {15335, 11, 2}, {18338, 10, 2}, {0, 0, 0},
+    {16231, 4, 2}, {30021, 4, 1}, {0, 0, 0}, {0, 0, 0}, {23738, 6, 2}, {0, 0, 0},
+    {30533, 3, 2}, {13560, 12, 2}, {0, 0, 0}, {8234, 16, 2}, {0, 0, 0}, {25461, 6, 2},
+    {0, 0, 0}, {22785, 8, 2}, {0, 0, 0}, {29677, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29613, 4, 2}, {20979, 9, 2}, {0, 0, 0}, {0, 0, 0}, {24032, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25349, 6, 2}, {16776, 3, 2}, {0, 0, 0},
+    {30173, 4, 2}, {0, 0, 0}, {0, 0, 0}, {24417, 7, 2}, {27065, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {25670, 7, 2}, {0, 0, 0}, {28601, 5, 2}, {0, 0, 0}, {27372, 5, 2},
+    {0, 0, 0}, {29653, 4, 2}, {13032, 12, 2}, {22569, 8, 2}, {27437, 6, 2}, {30281, 4, 2},
+    {27360, 5, 2}, {28496, 5, 2}, {17769, 9, 2}, {24893, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {15490, 10, 2}, {20880, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29945, 4, 2}, {0, 0, 0}, {0, 0, 0}, {18378, 10, 2}, {24606, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {15913, 5, 2}, {28956, 5, 2}, {28361, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29889, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {20331, 9, 2}, {20673, 9, 2}, {20218, 5, 2}, {25167, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {23322, 7, 2}, {20043, 9, 2}, {22505, 8, 2}, {30770, 3, 2}, {0, 0, 0}, {28606, 5, 2},
+    {0, 0, 0}, {19936, 8, 2}, {0, 0, 0}, {0, 0, 0}, {20610, 9, 2}, {0, 0, 0},
+    {21417, 8, 2}, {27881, 6, 2}, {0, 0, 0}, {15280, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11500, 13, 2}, {0, 0, 0}, {0, 0, 0}, {30431, 3, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {25202, 6, 2}, {0, 0, 0}, {28726, 5, 2}, {29521, 5, 1},
+    {30803, 2, 1}, {0, 0, 0}, {0, 0, 0}, {11682, 13, 2}, {17978, 10, 2}, {25740, 7, 2},
+    {0, 0, 0}, {25635, 7, 2}, {0, 0, 0}, {29366, 4, 1}, {0, 0, 0}, {27761, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {25215, 7, 2}, {0, 0, 0}, {27647, 6, 2}, {8146, 3, 2},
+    {26459, 6, 2}, {0, 0, 0}, {0, 0, 0}, {20835, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {22481, 8, 2}, {23201, 8, 2}, {15786, 11, 2}, {0, 0, 0}, {30297, 4, 2}, {17928, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20097, 9, 2}, {0, 0, 0}, {29031, 5, 2},
+    {27125, 6, 2}, {27227, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26921, 5, 2}, {20413, 8, 2}, {27828, 4, 2}, {26543, 6, 2}, {0, 0, 0}, {22009, 7, 2},
+    {0, 0, 0}, {29491, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11370, 13, 2},
+    {29416, 5, 1}, {30641, 3, 1}, {0, 0, 0}, {0, 0, 0}, {17878, 10, 2}, {13680, 12, 2},
+    {22009, 8, 2}, {27767, 6, 2}, {26183, 5, 2}, {16314, 11, 2}, {0, 0, 0}, {25594, 6, 2},
+    {15797, 11, 2}, {22321, 8, 2}, {15104, 11, 2}, {27629, 6, 2}, {15016, 11, 2}, {20862, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {18128, 10, 2}, {0, 0, 0}, {29526, 4, 1}, {0, 0, 0},
+    {27083, 5, 2}, {0, 0, 0}, {19989, 9, 2}, {18950, 4, 1}, {0, 0, 0}, {30137, 4, 2},
+    {0, 0, 0}, {25131, 7, 2}, {0, 0, 0}, {0, 0, 0}, {21060, 9, 2}, {13140, 12, 2},
+    {0, 0, 0}, {17888, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28756, 5, 2}, {27348, 5, 2}, {27804, 5, 2}, {30129, 4, 2}, {0, 0, 0}, {15456, 11, 2},
+    {23369, 8, 2}, {24998, 7, 2}, {0, 0, 0}, {28391, 5, 2}, {12792, 12, 2}, {16039, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30317, 4, 1}, {23724, 6, 2}, {21669, 4, 2}, {22025, 8, 2}, {9941, 14, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19917, 9, 2}, {20160, 9, 2}, {23289, 8, 2}, {29211, 5, 1},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20889, 9, 2}, {19827, 9, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {19863, 9, 2}, {0, 0, 0}, {0, 0, 0}, {25013, 6, 2},
+    {7506, 5, 1}, {27449, 6, 2}, {30333, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29251, 5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25356, 6, 2}, {30037, 4, 1},
+    {0, 0, 0}, {18279, 9, 2}, {29737, 3, 2}, {0, 0, 0}, {23073, 8, 2}, {0, 0, 0},
+    {22873, 8, 2}, {28706, 5, 2}, {17728, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22279, 3, 2}, {0, 0, 0}, {0, 0, 0}, {17300, 3, 1}, {15170, 11, 2}, {25103, 7, 2},
+    {11735, 12, 2}, {15775, 11, 2}, {0, 0, 0}, {30077, 4, 1}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28656, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20052, 9, 2}, {25433, 6, 2}, {0, 0, 0}, {25173, 7, 2}, {27467, 6, 2},
+    {0, 0, 0}, {22561, 8, 2}, {30536, 3, 2}, {0, 0, 0}, {0, 0, 0}, {10431, 14, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26591, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {15479, 10, 2}, {0, 0, 0}, {0, 0, 0}, {26831, 6, 2},
+    {0, 0, 0}, {27792, 5, 2}, {30734, 3, 1}, {24599, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {13524, 12, 2}, {29021, 5, 2}, {0, 0, 0}, {27461, 6, 2}, {28231, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {15467, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30728, 3, 1}, {22786, 6, 2}, {0, 0, 0}, {18368, 10, 2}, {24200, 7, 2}, {26927, 6, 2},
+    {22513, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30237, 4, 2}, {0, 0, 0}, {30560, 3, 2}, {27599, 6, 2}, {2448, 3, 2}, {0, 0, 0},
+    {15192, 11, 2}, {15203, 11, 2}, {20401, 2, 1}, {0, 0, 0}, {10137, 14, 2}, {0, 0, 0},
+    {0, 0, 0}, {23717, 7, 2}, {27594, 5, 2}, {0, 0, 0}, {0, 0, 0}, {10151, 14, 2},
+    {0, 0, 0}, {18229, 9, 2}, {0, 0, 0}, {25775, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20430, 9, 2}, {8012, 4, 2}, {0, 0, 0}, {12996, 12, 2}, {25628, 7, 2},
+    {10095, 14, 2}, {12684, 12, 2}, {10291, 14, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30807, 2, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {23290, 7, 2}, {26933, 6, 2}, {21087, 9, 2}, {0, 0, 0}, {25019, 7, 2}, {28876, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30157, 4, 2}, {16116, 11, 2}, {14862, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11952, 2, 1}, {29331, 5, 1},
+    {26297, 6, 2}, {27119, 6, 2}, {0, 0, 0}, {0, 0, 0}, {28796, 5, 2}, {11709, 12, 2},
+    {29297, 3, 1}, {29051, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9823, 3, 1},
+    {0, 0, 0}, {20952, 9, 2}, {0, 0, 0}, {11357, 13, 2}, {23014, 3, 1}, {29866, 3, 2},
+    {0, 0, 0}, {0, 0, 0}, {11344, 13, 2}, {0, 0, 0}, {0, 0, 0}, {30093, 4, 1},
+    {30033, 4, 1}, {0, 0, 0}, {0, 0, 0}, {12984, 12, 2}, {0, 0, 0}, {0, 0, 0},
+    {30459, 2, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {19044, 9, 2}, {18098, 10, 2}, {0, 0, 0}, {11722, 12, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16435, 11, 2}, {0, 0, 0}, {0, 0, 0}, {27845, 6, 2},
+    {0, 0, 0}, {1987, 4, 2}, {0, 0, 0}, {0, 0, 0}, {17358, 10, 2}, {23065, 8, 2},
+    {23738, 7, 2}, {0, 0, 0}, {27707, 6, 2}, {25692, 6, 2}, {13584, 12, 2}, {0, 0, 0},
+    {0, 0, 0}, {12888, 12, 2}, {0, 0, 0}, {15401, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {16083, 11, 2}, {0, 0, 0}, {0, 0, 0}, {16006, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {11487, 13, 2}, {8898, 15, 2}, {0, 0, 0}, {30313, 4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {18028, 10, 2}, {0, 0, 0}, {0, 0, 0}, {26333, 6, 2},
+    {13368, 12, 2}, {0, 0, 0}, {21761, 8, 2}, {29216, 5, 1}, {14939, 11, 2}, {29476, 4, 1},
+    {28411, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {28676, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {20053, 8, 2}, {12720, 12, 2}, {29151, 4, 2}, {15357, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27755, 6, 2},
+    {21578, 6, 2}, {0, 0, 0}, {25370, 6, 2}, {0, 0, 0}, {29837, 4, 2}, {0, 0, 0},
+    {25418, 7, 2}, {20350, 8, 2}, {30755, 3, 1}, {0, 0, 0}, {16259, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29411, 5, 1}, {0, 0, 0}, {0, 0, 0},
+    {21068, 2, 1}, {16391, 11, 2}, {28456, 5, 2}, {0, 0, 0}, {0, 0, 0}, {27809, 6, 2},
+    {30530, 3, 2}, {0, 0, 0}, {27876, 5, 2}, {0, 0, 0}, {0, 0, 0}, {22770, 7, 2},
+    {23123, 5, 2}, {0, 0, 0}, {0, 0, 0}, {25656, 7, 2}, {12840, 12, 2}, {18711, 9, 2},
+    {0, 0, 0}, {27384, 5, 2}, {0, 0, 0}, {0, 0, 0}, {5331, 2, 1}, {24452, 7, 1},
+    {23668, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {24039, 7, 2}, {0, 0, 0}, {0, 0, 0}, {27570, 5, 2}, {12816, 12, 2}, {0, 0, 0},
+    {30157, 3, 2}, {10403, 14, 2}, {20457, 9, 2}, {29929, 4, 2}, {27923, 6, 2}, {22594, 7, 2},
+    {0, 0, 0}, {24886, 7, 2}, {29306, 5, 2}, {29877, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {22521, 8, 2}, {0, 0, 0}, {0, 0, 0}, {29006, 5, 2},
+    {0, 0, 0}, {27617, 6, 2}, {27689, 6, 2}, {30009, 4, 1}, {19963, 8, 2}, {0, 0, 0},
+    {29246, 5, 1}, {15501, 10, 2}, {0, 0, 0}, {27889, 4, 2}, {17128, 7, 2}, {11552, 13, 2},
+    {29186, 5, 2}, {15918, 11, 2}, {19809, 9, 2}, {0, 0, 0}, {13800, 12, 2}, {23281, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {25621, 7, 2}, {10319, 14, 2}, {20376, 9, 2}, {15214, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {9675, 5, 2}, {16231, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28241, 5, 1}, {0, 0, 0}, {11321, 3, 1}, {0, 0, 0}, {30524, 3, 2}, {15904, 2, 1},
+    {30213, 4, 2}, {0, 0, 0}, {0, 0, 0}, {22961, 8, 2}, {0, 0, 0}, {8973, 15, 2},
+    {25180, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30017, 4, 1},
+    {28711, 5, 2}, {0, 0, 0}, {29276, 5, 1}, {29246, 4, 1}, {27414, 5, 2}, {30683, 3, 1},
+    {0, 0, 0}, {28821, 5, 2}, {0, 0, 0}, {13380, 12, 2}, {17738, 10, 2}, {0, 0, 0},
+    {12972, 12, 2}, {0, 0, 0}, {22705, 8, 2}, {25558, 7, 2}, {20152, 8, 2}, {0, 0, 0},
+    {14841, 6, 2}, {0, 0, 0}, {0, 0, 0}, {16667, 2, 1}, {0, 0, 0}, {0, 0, 0},
+    {19945, 8, 2}, {0, 0, 0}, {0, 0, 0}, {27563, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {19954, 8, 2}, {25054, 7, 2}, {0, 0, 0}, {2486, 3, 2}, {19773, 9, 2},
+    {0, 0, 0}, {11396, 13, 2}, {22296, 3, 2}, {30548, 3, 2}, {30494, 3, 1}, {22089, 8, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17488, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {12924, 12, 2}, {20511, 9, 2}, {22737, 8, 2}, {23934, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {30458, 3, 1}, {0, 0, 0}, {23202, 7, 2}, {15159, 11, 2},
+    {0, 0, 0}, {26441, 6, 2}, {28951, 5, 2}, {0, 0, 0}, {19971, 9, 2}, {29985, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27731, 6, 2}, {24186, 7, 2}, {20304, 7, 2},
+    {23955, 7, 2}, {0, 0, 0}, {23306, 7, 2}, {0, 0, 0}, {13896, 12, 2}, {0, 0, 0},
+    {27677, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21657, 8, 2},
+    {0, 0, 0}, {15390, 11, 2}, {0, 0, 0}, {23193, 8, 2}, {0, 0, 0}, {25336, 5, 2},
+    {0, 0, 0}, {27071, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {9899, 14, 2}, {17979, 9, 2}, {30325, 4, 1}, {25713, 6, 2}, {22482, 7, 2}, {21433, 8, 2},
+    {0, 0, 0}, {30189, 4, 2}, {22697, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {29221, 5, 1}, {14906, 11, 2}, {22754, 7, 2}, {30801, 2, 1}, {27089, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29181, 5, 2}, {28546, 5, 2}, {10011, 14, 2},
+    {0, 0, 0}, {0, 0, 0}, {26675, 6, 2}, {15368, 11, 2}, {30656, 3, 1}, {13020, 12, 2},
+    {0, 0, 0}, {0, 0, 0}, {17858, 10, 2}, {26165, 6, 2}, {26171, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {16348, 10, 2}, {0, 0, 0}, {0, 0, 0}, {30497, 3, 1}, {0, 0, 0},
+    {30689, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26309, 6, 2}, {0, 0, 0},
+    {29136, 5, 2}, {0, 0, 0}, {20764, 8, 2}, {0, 0, 0}, {0, 0, 0}, {16380, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {20313, 9, 2}, {0, 0, 0}, {0, 0, 0}, {25705, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {26315, 5, 2}, {29717, 4, 2}, {0, 0, 0}, {0, 0, 0},
+    {23323, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23353, 8, 2}, {15731, 11, 2}, {0, 0, 0}, {28171, 5, 2},
+    {2745, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16303, 11, 2},
+    {0, 0, 0}, {13704, 12, 2}, {12804, 12, 2}, {13176, 12, 2}, {30530, 2, 2}, {10389, 14, 2},
+    {0, 0, 0}, {29933, 4, 2}, {0, 0, 0}, {25397, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {30425, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15621, 11, 2},
+    {13776, 12, 2}, {20115, 9, 2}, {0, 0, 0}, {0, 0, 0}, {16182, 11, 2}, {22097, 8, 2},
+    {29396, 5, 1}, {20655, 9, 2}, {22857, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {5766, 2, 1}, {25600, 7, 2}, {22497, 8, 2}, {26941, 3, 2}, {0, 0, 0}, {15643, 11, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {23257, 8, 2}, {25509, 7, 2}, {27575, 6, 2},
+    {25614, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18008, 10, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27341, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {27533, 6, 2}, {23225, 8, 2}, {28497, 4, 2}, {24991, 7, 2},
+    {28681, 5, 2}, {0, 0, 0}, {30233, 4, 2}, {22681, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {29436, 5, 1}, {22793, 8, 2}, {25104, 6, 2}, {29291, 5, 1}, {14521, 8, 2}, {0, 0, 0},
+    {26921, 6, 2}, {26633, 6, 2}, {0, 0, 0}, {26381, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {28541, 5, 2}, {0, 0, 0}, {17988, 10, 2}, {20209, 5, 2}, {0, 0, 0}, {18228, 10, 2},
+    {0, 0, 0}, {0, 0, 0}, {24025, 7, 2}, {24403, 7, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30177, 4, 2}, {0, 0, 0}, {0, 0, 0}, {16215, 11, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {28181, 5, 2}, {30446, 3, 2}, {17789, 9, 2}, {22630, 2, 1},
+    {0, 0, 0}, {20142, 9, 2}, {0, 0, 0}, {20934, 9, 2}, {0, 0, 0}, {25124, 7, 2},
+    {30503, 3, 1}, {30731, 3, 1}, {8235, 15, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29789, 4, 2}, {30113, 4, 2}, {30025, 4, 1}, {0, 0, 0}, {8943, 15, 2}, {30614, 3, 1},
+    {20916, 6, 2}, {10039, 14, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {20412, 9, 2},
+    {25719, 7, 2}, {22834, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28916, 5, 2}, {0, 0, 0}, {0, 0, 0}, {20908, 8, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {25628, 6, 2}, {0, 0, 0}, {13548, 12, 2}, {29226, 5, 1}, {28441, 5, 2},
+    {16138, 11, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {22489, 8, 2}, {18648, 9, 2}, {0, 0, 0}, {16105, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {11474, 13, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {15896, 11, 2}, {16028, 11, 2},
+    {0, 0, 0}, {15907, 11, 2}, {16127, 11, 2}, {0, 0, 0}, {0, 0, 0}, {26897, 6, 2},
+    {17528, 10, 2}, {22209, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29785, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {30306, 3, 1}, {29266, 5, 1},
+    {20772, 9, 2}, {30365, 4, 1}, {9795, 3, 1}, {0, 0, 0}, {25257, 7, 2}, {0, 0, 0},
+    {27395, 6, 2}, {27473, 6, 2}, {0, 0, 0}, {0, 0, 0}, {26153, 6, 2}, {25187, 7, 2},
+    {20173, 5, 2}, {0, 0, 0}, {19845, 9, 2}, {13080, 12, 2}, {20664, 9, 2}, {23297, 8, 2},
+    {0, 0, 0}, {16282, 10, 2}, {25453, 7, 2}, {0, 0, 0}, {25363, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {15225, 11, 2}, {27378, 5, 2}, {20304, 9, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {23927, 7, 2}, {15852, 11, 2}, {26159, 6, 2}, {28421, 5, 2}, {15379, 11, 2},
+    {14884, 11, 2}, {1751, 2, 2}, {0, 0, 0}, {0, 0, 0}, {14829, 7, 2}, {0, 0, 0},
+    {0, 0, 0}, {15764, 11, 2}, {23354, 7, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {29737, 4, 2}, {0, 0, 0}, {26303, 6, 2}, {19890, 9, 2}, {0, 0, 0}, {27444, 5, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {17788, 10, 2},
+    {0, 0, 0}, {20205, 9, 2}, {0, 0, 0}, {9983, 14, 2}, {23105, 8, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27576, 5, 2},
+    {23009, 7, 2}, {27593, 6, 2}, {15468, 10, 2}, {27515, 6, 2}, {0, 0, 0}, {29001, 5, 2},
+    {0, 0, 0}, {16402, 11, 2}, {11708, 13, 2}, {14830, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {12936, 12, 2}, {19539, 9, 2}, {0, 0, 0}, {20214, 9, 2}, {22450, 7, 2}, {25327, 7, 2},
+    {0, 0, 0}, {0, 0, 0}, {20143, 8, 2}, {25474, 7, 2}, {12382, 3, 2}, {19045, 6, 2},
+    {29247, 3, 1}, {15973, 11, 2}, {0, 0, 0}, {4214, 3, 2}, {0, 0, 0}, {18239, 9, 2},
+    {30707, 3, 1}, {0, 0, 0}, {0, 0, 0}, {15940, 11, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20182, 5, 2}, {20277, 9, 2}, {27539, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {16226, 11, 2}, {0, 0, 0}, {30257, 4, 2},
+    {0, 0, 0}, {20259, 9, 2}, {0, 0, 0}, {29893, 4, 2}, {0, 0, 0}, {28946, 5, 2},
+    {20421, 9, 2}, {9809, 3, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {20439, 9, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9871, 14, 2},
+    {0, 0, 0}, {10179, 14, 2}, {22713, 8, 2}, {0, 0, 0}, {23330, 7, 2}, {25153, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26915, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {26387, 6, 2}, {0, 0, 0}, {25664, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {24613, 7, 2}, {0, 0, 0}, {25629, 6, 2},
+};
+static const quint16 asmKeywordsDisplacements[2048] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    4, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 0, 3, 0, 0, 0, 2,
+    1, 1, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 2, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 2, 0, 0, 0, 2, 3,
+    1, 0, 1, 3, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 4, 3, 0, 2, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 2, 0,
+    0, 2, 2, 2, 4, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 0, 0, 1, 0, 1, 3, 0, 0, 0, 5, 0, 3, 1, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 0, 3, 0, 1,
+    0, 0, 0, 0, 1, 2, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 2, 0, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, 0, 1, 3, 0,
+    0, 0, 0, 0, 0, 2, 4, 1, 0, 1, 0, 0, 0, 0, 3, 1,
+    2, 0, 0, 2, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+    1, 0, 1, 0, 0, 0, 2, 1, 0, 0, 2, 0, 1, 0, 0, 0,
+    0, 1, 2, 1, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 1,
+    4, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, 2, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 0, 1, 2, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 0,
+    3, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 2, 1, 0, 0, 1, 0, 0, 2, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 2, 2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0, 0,
+    0, 2, 0, 1, 1, 2, 1, 0, 2, 0, 0, 0, 2, 0, 0, 1,
+    0, 1, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0,
+    1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    2, 1, 0, 2, 0, 1, 1, 0, 0, 3, 0, 0, 0, 1, 0, 2,
+    2, 1, 1, 0, 0, 0, 2, 1, 0, 1, 0, 0, 1, 0, 2, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 2, 1, 0, 1, 0,
+    2, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 2, 1, 1, 0, 1, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 1,
+    1, 1, 0, 0, 0, 2, 1, 0, 0, 2, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2,
+    0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 1, 3, 0,
+    0, 1, 1, 5, 1, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0,
+    1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0,
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+    2, 0, 1, 1, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 2,
+    0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 1, 2, 0, 1, 1, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 3, 0, 0,
+    1, 0, 1, 0, 1, 2, 0, 2, 0, 1, 0, 0, 1, 2, 2, 0,
+    1, 1, 0, 0, 1, 1, 2, 0, 2, 1, 0, 0, 0, 0, 0, 1,
+    2, 1, 0, 1, 1, 0, 1, 1, 0, 0, 4, 0, 0, 0, 0, 1,
+    3, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 1, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 1, 3, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 2,
+    0, 1, 0, 2, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0,
+    1, 0, 1, 0, 0, 0, 0, 2, 1, 0, 2, 2, 1, 0, 4, 0,
+    1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+    0, 5, 2, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 7, 1, 1,
+    0, 2, 5, 0, 2, 1, 2, 5, 1, 0, 0, 3, 1, 0, 0, 0,
+    3, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 1, 0, 6, 0, 2, 0, 0, 0, 1, 1, 2, 0, 1, 0, 0,
+    1, 0, 0, 0, 1, 1, 1, 0, 2, 0, 1, 1, 1, 0, 1, 2,
+    0, 1, 0, 1, 0, 0, 0, 1, 0, 2, 2, 0, 1, 0, 0, 0,
+    0, 4, 3, 0, 0, 1, 2, 0, 3, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 1, 2, 2, 1, 2, 0, 0, 0, 1, 0, 0, 0, 1, 2,
+    0, 1, 0, 4, 2, 0, 0, 0, 0, 2, 1, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 3, 1, 1, 0, 1, 0, 0, 0, 0,
+    1, 0, 0, 2, 0, 0, 3, 1, 0, 0, 0, 2, 0, 0, 1, 1,
+    0, 1, 2, 2, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 3, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 3, 2, 0, 5, 0, 0, 0, 0, 2, 3, 0, 0, 1, 1, 0,
+    3, 2, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 3, 3, 0, 0, 0, 1, 2, 0, 0, 0, 2, 6, 0, 0,
+    0, 3, 0, 0, 2, 0, 0, 0, 0, 1, 2, 1, 0, 0, 2, 3,
+    0, 0, 2, 0, 0, 0, 0, 0, 2, 1, 3, 1, 1, 0, 0, 0,
+    2, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 4, 5, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+    3, 0, 0, 1, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 0,
+    1, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 2, 2,
+    0, 1, 0, 3, 0, 0, 2, 1, 0, 1, 1, 0, 0, 0, 2, 0,
+    0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 3, 2, 2, 0, 0,
+    0, 0, 3, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+    0, 3, 0, 0, 1, 1, 0, 3, 0, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 2, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 2, 0,
+    2, 0, 2, 2, 0, 2, 0, 0, 1, 6, 0, 0, 0, 0, 0, 3,
+    0, 1, 1, 0, 1, 1, 1, 2, 0, 1, 0, 0, 2, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 1, 0, 0, 4, 0, 1,
+    1, 1, 0, 0, 2, 1, 0, 2, 1, 0, 0, 0, 0, 3, 0, 0,
+    1, 2, 0, 0, 0, 0, 1, 1, 0, 5, 0, 0, 1, 3, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 2,
+    1, 1, 0, 0, 0, 0, 2, 0, 2, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 1, 0, 3, 1, 3, 0, 0, 1, 0, 1,
+    0, 0, 0, 1, 0, 2, 0, 0, 2, 0, 2, 0, 0, 4, 1, 0,
+    0, 2, 0, 1, 0, 0, 3, 3, 3, 0, 1, 0, 1, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 3, 0, 4, 0, 0, 2, 1, 0, 0, 0,
+    3, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 2, 1, 0, 0,
+    0, 0, 2, 0, 0, 1, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0,
+    0, 0, 5, 2, 0, 0, 2, 0, 7, 0, 0, 0, 1, 0, 0, 3,
+};
+const KeywordTable asmKeywords = { wordPool, asmKeywordsEntries, asmKeywordsDisplacements, 4096, 2048, 16, 1 };
+static const KeywordSlot rhaiKeywordsEntries[512] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {1751, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {18596, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1753, 3, 2}, {8218, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17388, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2729, 2, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {8771, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {21356, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {11022, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {7968, 2, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {26261, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7962, 5, 4}, {18885, 6, 2}, {19152, 9, 4},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12636, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {17068, 10, 4}, {0, 0, 0}, {0, 0, 0}, {9537, 6, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21289, 4, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11322, 4, 3}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26651, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28126, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4903, 2, 2}, {0, 0, 0}, {0, 0, 0},
+    {29016, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29841, 4, 2},
+    {24466, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {19143, 9, 4}, {9903, 5, 3}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {30575, 3, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {21348, 5, 2}, {0, 0, 0}, {8786, 7, 2}, {0, 0, 0}, {0, 0, 0}, {30245, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {17584, 4, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {25229, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5331, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {23829, 7, 2}, {0, 0, 0}, {0, 0, 0}, {6874, 3, 2},
+    {24641, 7, 2}, {0, 0, 0}, {0, 0, 0}, {28106, 5, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19458, 9, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {29081, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12600, 4, 2}, {0, 0, 0},
+    {0, 0, 0}, {7395, 6, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {14691, 4, 4}, {19652, 4, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {26903, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11201, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {27245, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {18723, 6, 2}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21548, 5, 2}, {0, 0, 0}, {28981, 5, 2}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {16768, 5, 2}, {24935, 7, 4}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {26209, 3, 2}, {0, 0, 0}, {0, 0, 0}, {2446, 6, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {7426, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {21393, 8, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {30785, 2, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {28051, 5, 2}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {28211, 5, 4}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {13321, 2, 2},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0},
+};
+static const quint16 rhaiKeywordsDisplacements[32] = {
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+    0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+};
+const KeywordTable rhaiKeywords = { wordPool, rhaiKeywordsEntries, rhaiKeywordsDisplacements, 512, 32, 10, 0 };
+
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is generated by tools/languagetablesgen from languagedata.cpp.
+ * Do not edit it by hand, edit languagedata.cpp and rerun the generator.
+ */
+
+#ifndef QSOURCEHIGHLITE_LANGUAGETABLES_H
+#define QSOURCEHIGHLITE_LANGUAGETABLES_H
+
+#include "keywordtable.h"
+
+namespace QSourceHighlite {
+
+extern const KeywordTable luaKeywords;
+extern const KeywordTable cppKeywords;
+extern const KeywordTable shellKeywords;
+extern const KeywordTable jsKeywords;
+extern const KeywordTable phpKeywords;
+extern const KeywordTable qmlKeywords;
+extern const KeywordTable pyKeywords;
+extern const KeywordTable rustKeywords;
+extern const KeywordTable javaKeywords;
+extern const KeywordTable csharpKeywords;
+extern const KeywordTable goKeywords;
+extern const KeywordTable vKeywords;
+extern const KeywordTable sqlKeywords;
+extern const KeywordTable jsonKeywords;
+extern const KeywordTable cssKeywords;
+extern const KeywordTable typescriptKeywords;
+extern const KeywordTable yamlKeywords;
+extern const KeywordTable vexKeywords;
+extern const KeywordTable cmakeKeywords;
+extern const KeywordTable makeKeywords;
+extern const KeywordTable asmKeywords;
+extern const KeywordTable rhaiKeywords;
+
+}
+#endif // QSOURCEHIGHLITE_LANGUAGETABLES_H
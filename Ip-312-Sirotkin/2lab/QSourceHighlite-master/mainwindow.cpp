@@ -24,6 +24,7 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "qsourcehighliter.h"
+#include "qsourcehighlightscheduler.h"
 #include "searchdialog.h"
 #include <QDebug>
 #include <QDir>
@@ -54,6 +55,14 @@ MainWindow::MainWindow(QWidget *parent)
     ui->plainTextEdit->setFont(f);
 
     highlighter = new QSourceHighliter(ui->plainTextEdit->document());
+    scheduler = new QSourceHighlightScheduler(highlighter, ui->plainTextEdit, this);
+
+    //shown while long lines on screen are only partly highlighted
+    degradedLabel = new QLabel(tr("Длинные строки: упрощённая подсветка"), this);
+    degradedLabel->hide();
+    ui->statusbar->addPermanentWidget(degradedLabel);
+    connect(scheduler, &QSourceHighlightScheduler::degradedChanged,
+            degradedLabel, &QLabel::setVisible);
 
     int currentThemeIndex = ui->themeComboBox->currentIndex();
     themeChanged(currentThemeIndex);
@@ -227,7 +236,7 @@ void MainWindow::initLangsComboBox() {
 
 void MainWindow::themeChanged(int) {
     QSourceHighliter::Themes theme = (QSourceHighliter::Themes)ui->themeComboBox->currentData().toInt();
-    highlighter->setTheme(theme);
+    scheduler->setTheme(theme);
     applyEditorBackground(theme);
 }
 
@@ -301,14 +310,14 @@ void MainWindow::replaceText(const QString &find, const QString &replace) {
     } else {
         QMessageBox::information(this, "Замена", "Совпадений не найдено");
     }
-    highlighter->rehighlight();
+    scheduler->rehighlight();
 }
 
 void MainWindow::onReplaceAll(const QString &find, const QString &replace) {
     QString content = ui->plainTextEdit->toPlainText();
     QString newContent = content.replace(find, replace, Qt::CaseSensitive);
     ui->plainTextEdit->setPlainText(newContent);
-    highlighter->rehighlight();
+    scheduler->rehighlight();
 
     QString message = QString("Все вхождения '%1' заменены на '%2'").arg(find).arg(replace);
     ui->statusbar->showMessage(message, 3000);
@@ -439,8 +448,7 @@ void MainWindow::on_actionTXT_opener(){
 }
 
 void MainWindow::languageChanged(const QString &lang) {
-    highlighter->setCurrentLanguage(_langStringToEnum.value(lang));
-    highlighter->rehighlight();
+    scheduler->setLanguage(_langStringToEnum.value(lang));
 //    QFile f(QDir::currentPath() + "/../test_files/" + lang + ".txt");
 //    if (f.open(QIODevice::ReadOnly | QIODevice::Text)) {
 //        const auto text = f.readAll();
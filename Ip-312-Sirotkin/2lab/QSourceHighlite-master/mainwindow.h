@@ -26,6 +26,7 @@
 
 #include <QMainWindow>
 #include <qsourcehighliter.h>
+#include <qsourcehighlightscheduler.h>
 #include <QFileDialog>
 #include <QFile>
 #include <QJsonObject>
@@ -37,6 +38,7 @@
 #include <QPushButton>
 #include <QDialog>
 #include <QLineEdit>
+#include <QLabel>
 #include "searchdialog.h"
 #include "qsourcehighliterthemes.h"
 #include <QProcess>
@@ -59,6 +61,8 @@ public:
 private:
     Ui::MainWindow *ui;
     QSourceHighlite::QSourceHighliter *highlighter;
+    QSourceHighlite::QSourceHighlightScheduler *scheduler;
+    QLabel *degradedLabel;
     static QHash<QString, QSourceHighlite::QSourceHighliter::Language> _langStringToEnum;
 
     QThread *workerThread;
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "qsourcehighlightscheduler.h"
+#include "qsourcetokenizer.h"
+
+#include <QElapsedTimer>
+#include <QPlainTextEdit>
+#include <QRunnable>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QTextDocument>
+
+#include <climits>
+
+namespace QSourceHighlite {
+
+static const int notDone = INT_MIN;
+// the long-line guard the scheduler sets, see setLongLineGuard()
+static const int guardLength = 10000;
+static const int guardBudget = 20;
+
+/**
+ * @brief Lexes a line cut short by the long-line guard in full
+ * @details The result is handed back to the scheduler on its own thread.
+ */
+class LineCompleter : public QRunnable
+{
+public:
+    LineCompleter(QSourceHighlightScheduler *scheduler, int blockNumber, const QString &text,
+                  int inState, QSourceHighliter::Language language)
+        : _scheduler(scheduler), _blockNumber(blockNumber), _text(text),
+          _inState(inState), _language(language) {}
+
+    void run() override
+    {
+        QSourceTokenizer tokenizer;
+        TokenizedLine line;
+        line.state = tokenizer.tokenize(_text, _language, _inState, line.spans);
+        const uint textHash = qHash(_text);
+
+        // the scheduler's pool waits for this before the scheduler goes
+        QSourceHighlightScheduler *scheduler = _scheduler;
+        const int blockNumber = _blockNumber;
+        const int inState = _inState;
+        const QSourceHighliter::Language language = _language;
+        QMetaObject::invokeMethod(scheduler, [=] {
+            scheduler->finishBlock(blockNumber, textHash, inState, language, line);
+        }, Qt::QueuedConnection);
+    }
+
+private:
+    QSourceHighlightScheduler *const _scheduler;
+    const int _blockNumber;
+    const QString _text;
+    const int _inState;
+    const QSourceHighliter::Language _language;
+};
+
+QSourceHighlightScheduler::QSourceHighlightScheduler(QSourceHighliter *highlighter,
+                                                     QPlainTextEdit *editor,
+                                                     QObject *parent)
+    : QObject(parent),
+      _highlighter(highlighter),
+      _editor(editor),
+      _sliceBudget(4),
+      _highlighting(false),
+      _nextBlock(0),
+      _degraded(false)
+{
+    // a 0 ms timer fires whenever the event loop has nothing else to do
+    _sliceTimer.setInterval(0);
+    connect(&_sliceTimer, &QTimer::timeout, this, &QSourceHighlightScheduler::highlightSlice);
+
+    // degraded blocks are looked for once highlighting has settled
+    _completeTimer.setSingleShot(true);
+    _completeTimer.setInterval(0);
+    connect(&_completeTimer, &QTimer::timeout,
+            this, &QSourceHighlightScheduler::completeVisibleBlocks);
+    // one long line at a time, they are rare and each one is big
+    _completers.setMaxThreadCount(1);
+    _highlighter->setLongLineGuard(guardLength, guardBudget);
+
+    connect(_editor->verticalScrollBar(), &QScrollBar::valueChanged, this, [this] {
+        if (isBusy())
+            highlightVisibleBlocks();
+        _completeTimer.start();
+    });
+    connect(_editor->document(), &QTextDocument::contentsChange,
+            this, &QSourceHighlightScheduler::contentsChange);
+}
+
+void QSourceHighlightScheduler::setLanguage(QSourceHighliter::Language language)
+{
+    _highlighter->setCurrentLanguage(language);
+    rehighlight();
+}
+
+void QSourceHighlightScheduler::setTheme(QSourceHighliter::Themes theme)
+{
+    _highlighter->loadTheme(theme);
+    rehighlight();
+}
+
+void QSourceHighlightScheduler::rehighlight()
+{
+    _nextBlock = 0;
+    _entryStates.fill(notDone, _editor->document()->blockCount());
+    highlightVisibleBlocks();
+    _sliceTimer.start();
+    _completeTimer.start();
+}
+
+void QSourceHighlightScheduler::setSliceBudget(int msecs)
+{
+    _sliceBudget = msecs;
+}
+
+bool QSourceHighlightScheduler::isBusy() const
+{
+    return _sliceTimer.isActive();
+}
+
+/**
+ * @brief highlights a block and records the entry state it was
+ * highlighted with
+ * @return the state the block ends in
+ */
+int QSourceHighlightScheduler::highlight(QTextBlock block, int inState)
+{
+    _entryStates[block.blockNumber()] = inState;
+    _highlighting = true;
+    const int state = _highlighter->rehighlightBlockFrom(block, inState);
+    _highlighting = false;
+    return state;
+}
+
+void QSourceHighlightScheduler::highlightVisibleBlocks()
+{
+    QTextBlock block = _editor->cursorForPosition(QPoint(0, 0)).block();
+    const QTextBlock last =
+            _editor->cursorForPosition(QPoint(0, _editor->viewport()->height() - 1)).block();
+    if (!block.isValid())
+        return;
+
+    int n = block.blockNumber();
+    // the real entry state is only known for blocks the slices reached,
+    // elsewhere the best guess is the previous block's state, or none
+    int state = -1;
+    if (n > 0 && (n <= _nextBlock || _entryStates.at(n - 1) != notDone))
+        state = block.previous().userState();
+    else if (n > 0)
+        state = _highlighter->currentLanguage();
+
+    while (block.isValid()) {
+        if (n >= _nextBlock && _entryStates.at(n) != state)
+            state = highlight(block, state);
+        else
+            state = block.userState();
+        if (block == last)
+            break;
+        block = block.next();
+        ++n;
+    }
+}
+
+/**
+ * @brief starts lexing the degraded blocks on screen in full
+ */
+void QSourceHighlightScheduler::completeVisibleBlocks()
+{
+    QTextBlock block = _editor->cursorForPosition(QPoint(0, 0)).block();
+    const QTextBlock last =
+            _editor->cursorForPosition(QPoint(0, _editor->viewport()->height() - 1)).block();
+
+    bool degraded = false;
+    for (; block.isValid(); block = block.next()) {
+        if (_highlighter->isDegraded(block)) {
+            degraded = true;
+            const int n = block.blockNumber();
+            if (!_completing.contains(n)) {
+                _completing.insert(n);
+                const int inState = block.previous().isValid() ? block.previous().userState() : -1;
+                _completers.start(new LineCompleter(this, n, block.text(), inState,
+                                                    _highlighter->currentLanguage()));
+            }
+        }
+        if (block == last)
+            break;
+    }
+
+    if (degraded != _degraded) {
+        _degraded = degraded;
+        emit degradedChanged(degraded);
+    }
+}
+
+/**
+ * @brief applies a block lexed by a LineCompleter
+ * @details The block may have been edited, moved or lexed from another
+ * state in the meantime, it is then left to the next
+ * completeVisibleBlocks() after an edit, scroll or slice.
+ */
+void QSourceHighlightScheduler::finishBlock(int blockNumber, uint textHash, int inState,
+                                            QSourceHighliter::Language language,
+                                            TokenizedLine line)
+{
+    _completing.remove(blockNumber);
+    const QTextBlock block = _editor->document()->findBlockByNumber(blockNumber);
+    if (!block.isValid())
+        return;
+
+    _highlighting = true;
+    const bool completed = _highlighter->completeBlock(block, textHash, inState, language, line);
+    _highlighting = false;
+    // updates degradedChanged()
+    if (completed)
+        _completeTimer.start();
+}
+
+void QSourceHighlightScheduler::highlightSlice()
+{
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    QTextBlock block = _editor->document()->findBlockByNumber(_nextBlock);
+    int state = block.previous().isValid() ? block.previous().userState() : -1;
+    while (block.isValid()) {
+        // blocks on screen may already be done with the right state
+        if (_entryStates.at(_nextBlock) != state)
+            state = highlight(block, state);
+        else
+            state = block.userState();
+        block = block.next();
+        ++_nextBlock;
+        if (elapsed.hasExpired(_sliceBudget))
+            break;
+    }
+
+    if (!block.isValid()) {
+        _sliceTimer.stop();
+        _entryStates.clear();
+        _completeTimer.start();
+    }
+}
+
+/**
+ * @brief keeps the bookkeeping in line with edits made while recoloring
+ * @details QSyntaxHighlighter highlights edited blocks itself. Everything
+ * from the edit on is left to the slices again, since block numbers after
+ * it may have shifted.
+ */
+void QSourceHighlightScheduler::contentsChange(int position, int charsRemoved, int charsAdded)
+{
+    Q_UNUSED(charsRemoved)
+    Q_UNUSED(charsAdded)
+    if (_highlighting)
+        return;
+    // the edited block may have been lexed past the long-line guard
+    _completeTimer.start();
+    if (!isBusy())
+        return;
+
+    const QTextDocument *doc = _editor->document();
+    const int first = qMax(doc->findBlock(position).blockNumber(), 0);
+    _nextBlock = qMin(_nextBlock, first);
+    _entryStates.resize(doc->blockCount());
+    for (int i = first; i < _entryStates.size(); ++i)
+        _entryStates[i] = notDone;
+}
+
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef QSOURCEHIGHLIGHTSCHEDULER_H
+#define QSOURCEHIGHLIGHTSCHEDULER_H
+
+#include "qsourcehighliter.h"
+
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+class QPlainTextEdit;
+QT_END_NAMESPACE
+
+namespace QSourceHighlite {
+
+/**
+ * @brief Recolors the document of a QPlainTextEdit without blocking it
+ * @details Changing the language or theme through the scheduler
+ * highlights the blocks on screen right away. The rest of the document is
+ * then highlighted from the top in short slices while the event loop is
+ * idle, and whatever scrolls into view first is highlighted next.
+ *
+ * Blocks on screen that the slices haven't reached yet are highlighted
+ * assuming they don't start inside a comment. The slices correct them if
+ * that was wrong.
+ *
+ * It turns on the long-line guard of QSourceHighliter. Lines cut short by
+ * it are lexed in full on a worker thread once they are on screen, and
+ * their highlighting is completed when that is done.
+ */
+class QSourceHighlightScheduler : public QObject
+{
+    Q_OBJECT
+    friend class LineCompleter;
+public:
+    QSourceHighlightScheduler(QSourceHighliter *highlighter, QPlainTextEdit *editor,
+                              QObject *parent = nullptr);
+
+    void setLanguage(QSourceHighliter::Language language);
+    void setTheme(QSourceHighliter::Themes theme);
+
+    /**
+     * @brief recolors the whole document, visible blocks first
+     */
+    void rehighlight();
+
+    /**
+     * @brief how long one slice may highlight before returning to the
+     * event loop, 4 ms by default
+     */
+    void setSliceBudget(int msecs);
+    Q_REQUIRED_RESULT bool isBusy() const;
+
+signals:
+    /**
+     * @brief emitted when blocks on screen start or stop being shown with
+     * the reduced highlighting of the long-line guard
+     */
+    void degradedChanged(bool degraded);
+
+private:
+    void highlightVisibleBlocks();
+    void completeVisibleBlocks();
+    void finishBlock(int blockNumber, uint textHash, int inState,
+                     QSourceHighliter::Language language, TokenizedLine line);
+    void highlightSlice();
+    void contentsChange(int position, int charsRemoved, int charsAdded);
+    int highlight(QTextBlock block, int inState);
+
+    QSourceHighliter *_highlighter;
+    QPlainTextEdit *_editor;
+    QTimer _sliceTimer;
+    int _sliceBudget;
+    // applying formats marks the document dirty, which is reported as
+    // a change too
+    bool _highlighting;
+    // the slices have highlighted every block before this one
+    int _nextBlock;
+    // the entry state each block was highlighted with, notDone if it
+    // hasn't been yet
+    QVector<int> _entryStates;
+    QTimer _completeTimer;
+    // lexes degraded blocks in full, waits for them when destroyed
+    QThreadPool _completers;
+    // blocks being lexed in full, by block number
+    QSet<int> _completing;
+    bool _degraded;
+};
+
+}
+#endif // QSOURCEHIGHLIGHTSCHEDULER_H
@@ -25,15 +25,19 @@
 #define QSOURCEHIGHLITER_H
 
 #include <QSyntaxHighlighter>
-
-#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-#include <QStringView>
-#endif
+#include <QScopedPointer>
+#include <QVector>
 
 namespace QSourceHighlite {
 
+class QSourceTokenizer;
+struct TokenSpan;
+struct TokenizedLine;
+struct TokenCache;
+
 class QSourceHighliter : public QSyntaxHighlighter
 {
+    friend class QSourceHighlightScheduler;
 public:
     enum Themes {
         Monokai = 1,
@@ -43,6 +47,7 @@ public:
 
     explicit QSourceHighliter(QTextDocument *doc);
     QSourceHighliter(QTextDocument *doc, Themes theme);
+    ~QSourceHighliter() override;
 
     //languages
     /*********
@@ -114,59 +119,81 @@ public:
 
     void setCurrentLanguage(Language language);
     Q_REQUIRED_RESULT Language currentLanguage();
-    void setTheme(Themes theme);
 
-protected:
-    void highlightBlock(const QString &text) override;
+    /**
+     * @brief switches to another theme
+     * @details Every block keeps its spans in its QTextBlockUserData, so
+     * this only applies the new formats to them, the text isn't lexed
+     * again.
+     */
+    void setTheme(Themes theme);
 
-private:
-    void highlightSyntax(const QString &text);
-    Q_REQUIRED_RESULT int highlightNumericLiterals(const QString &text, int i);
-    Q_REQUIRED_RESULT int highlightStringLiterals(const QChar strType, const QString &text, int i);
+    /**
+     * @brief rehighlights the whole document like rehighlight(), lexing
+     * it on the global QThreadPool first
+     * @details The document is split into chunks that are lexed in
+     * parallel, each assuming it doesn't start inside a comment. Chunks
+     * that do are lexed again until their states agree with the
+     * speculative ones. Small documents are rehighlighted directly.
+     * It returns once the whole document is highlighted; the calling
+     * thread lexes chunks too rather than wait idle, but it is blocked
+     * all the same. QSourceHighlightScheduler keeps a GUI responsive.
+     */
+    void rehighlightParallel();
 
     /**
-     * @brief returns true if c is octal
-     * @param c the char being checked
-     * @returns true if the number is octal, false otherwise
+     * @brief bounds the time spent lexing a long line
+     * @details A line of more than length characters gets msecs of full
+     * lexing, the rest of it only has its strings, comments and numbers
+     * highlighted. Nothing completes such lines later but
+     * QSourceHighlightScheduler, which turns the guard on with 10000
+     * characters and 20 ms. Off by default, 0 msecs turns it off.
      */
-    Q_REQUIRED_RESULT static constexpr inline bool isOctal(const char c) {
-        return (c >= '0' && c <= '7');
-    }
+    void setLongLineGuard(int length, int msecs);
+    Q_REQUIRED_RESULT bool isDegraded(const QTextBlock &block) const;
 
     /**
-     * @brief returns true if c is hex
-     * @param c the char being checked
-     * @returns true if the number is hex, false otherwise
+     * @brief loads the languages of a grammar file compiled by
+     * tools/grammarcompiler
+     * @details The file is memory-mapped and its keyword tables are used in
+     * place. A language is selected with setCurrentLanguage() by the id it
+     * has in the file, a grammar with the id of a built-in language
+     * replaces it. Safe to call while other threads highlight.
+     * @param errorString if not null, set to the reason the file couldn't
+     * be loaded
      */
-    Q_REQUIRED_RESULT static constexpr inline bool isHex(const char c) {
-        return (
-            (c >= '0' && c <= '9') ||
-            (c >= 'a' && c <= 'f') ||
-            (c >= 'A' && c <= 'F')
-        );
-    }
-
-    void cssHighlighter(const QString &text);
-    void ymlHighlighter(const QString &text);
-    void xmlHighlighter(const QString &text);
-    void makeHighlighter(const QString &text);
-    void highlightInlineAsmLabels(const QString& text);
-    void asmHighlighter(const QString& text);
-    void initFormats();
+    static bool loadGrammar(const QString &fileName, QString *errorString = nullptr);
+
+protected:
+    void highlightBlock(const QString &text) override;
 
-#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-    static inline QStringView strMidRef(const QString& str, qsizetype position, qsizetype n = -1)
-    {
-        return QStringView(str).mid(position, n);
-    }
-#else
-    static inline QStringRef strMidRef(const QString& str, int position, int n = -1)
-    {
-        return str.midRef(position, n);
-    }
-#endif
+private:
+    void initFormats();
+    void updateDerivedFormats();
+    void loadTheme(Themes theme);
+    int rehighlightBlockFrom(QTextBlock block, int inState);
+    Q_REQUIRED_RESULT TokenCache *tokenCache(QTextBlock block) const;
+    int lex(TokenCache *cache, const QString &text, uint hash, int inState);
+    bool completeBlock(QTextBlock block, uint textHash, int inState, Language language,
+                       TokenizedLine &line);
+    Q_REQUIRED_RESULT QTextCharFormat swatchFormat(const TokenSpan &span) const;
+    void applySpans(const QVector<TokenSpan> &spans, int textLen);
 
     QHash<Token, QTextCharFormat> _formats;
+    // _formats and their underlined versions, indexed by Token, so that
+    // highlighting never looks up or copies a format
+    QTextCharFormat _tokenFormats[CodeBuiltIn + 1];
+    QTextCharFormat _underlinedFormats[CodeBuiltIn + 1];
+    // plain text is left alone if the CodeBlock format is empty
+    bool _skipDefaultRuns;
+    // swatchFormat() by background color, cleared with the theme
+    mutable QHash<QRgb, QTextCharFormat> _swatchFormats;
+    QScopedPointer<QSourceTokenizer> _tokenizer;
+    // lines lexed by rehighlightParallel(), by block number, while it
+    // applies them
+    QVector<TokenizedLine> _lexedLines;
+    // the block rehighlightBlockFrom() is applying, already lexed
+    TokenCache *_pendingBlock;
     Language _language;
 };
 }
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "qsourcehighlitetracer.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <QVector>
+
+#include <algorithm>
+#include <atomic>
+
+namespace QSourceHighlite {
+
+#ifdef QSOURCEHIGHLITE_TRACE
+
+static const char *const phaseNames[QSourceHighliteTracer::PhaseCount] = {
+    "resolve tables",
+    "main scan",
+    "numeric literals",
+    "string literals",
+    "css pass",
+    "yaml pass",
+    "xml pass",
+    "make pass",
+    "asm pass",
+    "apply formats"
+};
+
+static const char *const counterNames[QSourceHighliteTracer::CounterCount] = {
+    "blocks highlighted",
+    "blocks lexed",
+    "cache hits",
+    "cascaded blocks",
+    "words classified",
+    "setFormat calls"
+};
+
+namespace {
+
+struct TraceEvent {
+    qint64 start;
+    qint64 duration;
+    QSourceHighliteTracer::Phase phase;
+};
+
+/**
+ * @brief what one thread recorded, only written by that thread
+ */
+struct ThreadTrace {
+    int tid;
+    qint64 phaseNs[QSourceHighliteTracer::PhaseCount];
+    quint64 phaseCalls[QSourceHighliteTracer::PhaseCount];
+    quint64 counters[QSourceHighliteTracer::CounterCount];
+    QVector<TraceEvent> events;
+    quint64 droppedEvents;
+
+    void clear()
+    {
+        std::fill(phaseNs, phaseNs + QSourceHighliteTracer::PhaseCount, 0);
+        std::fill(phaseCalls, phaseCalls + QSourceHighliteTracer::PhaseCount, 0);
+        std::fill(counters, counters + QSourceHighliteTracer::CounterCount, 0);
+        events.clear();
+        droppedEvents = 0;
+    }
+};
+
+struct TraceRegistry {
+    TraceRegistry() { clock.start(); }
+
+    QMutex mutex;
+    // threads come and go with the thread pool, their traces stay
+    QVector<ThreadTrace *> threads;
+    QElapsedTimer clock;
+};
+
+}
+
+static std::atomic<bool> traceEnabled(false);
+static std::atomic<int> maxEvents(100000);
+
+static TraceRegistry &registry()
+{
+    static TraceRegistry r;
+    return r;
+}
+
+static ThreadTrace &threadTrace()
+{
+    static thread_local ThreadTrace *trace = nullptr;
+    if (!trace) {
+        TraceRegistry &r = registry();
+        QMutexLocker lock(&r.mutex);
+        trace = new ThreadTrace;
+        trace->tid = r.threads.size() + 1;
+        trace->clear();
+        r.threads.append(trace);
+    }
+    return *trace;
+}
+
+void QSourceHighliteTracer::setEnabled(bool enabled)
+{
+    registry();
+    traceEnabled.store(enabled);
+}
+
+bool QSourceHighliteTracer::isEnabled()
+{
+    return traceEnabled.load(std::memory_order_relaxed);
+}
+
+void QSourceHighliteTracer::setMaxEvents(int max)
+{
+    maxEvents.store(max);
+}
+
+void QSourceHighliteTracer::reset()
+{
+    TraceRegistry &r = registry();
+    QMutexLocker lock(&r.mutex);
+    for (ThreadTrace *trace : qAsConst(r.threads))
+        trace->clear();
+}
+
+void QSourceHighliteTracer::count(Counter counter, int n)
+{
+    if (isEnabled())
+        threadTrace().counters[counter] += n;
+}
+
+quint64 QSourceHighliteTracer::total(Counter counter)
+{
+    TraceRegistry &r = registry();
+    QMutexLocker lock(&r.mutex);
+    quint64 total = 0;
+    for (const ThreadTrace *trace : qAsConst(r.threads))
+        total += trace->counters[counter];
+    return total;
+}
+
+QSourceHighliteTracer::Scope::Scope(Phase phase)
+    : _phase(phase),
+      _start(isEnabled() ? registry().clock.nsecsElapsed() : -1)
+{
+}
+
+QSourceHighliteTracer::Scope::~Scope()
+{
+    if (_start < 0)
+        return;
+    const qint64 duration = registry().clock.nsecsElapsed() - _start;
+    ThreadTrace &trace = threadTrace();
+    trace.phaseNs[_phase] += duration;
+    ++trace.phaseCalls[_phase];
+    if (trace.events.size() < maxEvents.load(std::memory_order_relaxed)) {
+        const TraceEvent event = { _start, duration, _phase };
+        trace.events.append(event);
+    } else
+        ++trace.droppedEvents;
+}
+
+bool QSourceHighliteTracer::writeChromeTrace(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+        return false;
+
+    TraceRegistry &r = registry();
+    QMutexLocker lock(&r.mutex);
+    const qint64 pid = QCoreApplication::applicationPid();
+    const qint64 end = r.clock.nsecsElapsed();
+
+    QTextStream out(&file);
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const ThreadTrace *trace : qAsConst(r.threads)) {
+        for (const TraceEvent &e : trace->events) {
+            out << (first ? "" : ",\n")
+                << "{\"name\":\"" << phaseNames[e.phase]
+                << "\",\"cat\":\"qsourcehighlite\",\"ph\":\"X\",\"ts\":"
+                << QString::number(e.start / 1e3, 'f', 3)
+                << ",\"dur\":" << QString::number(e.duration / 1e3, 'f', 3)
+                << ",\"pid\":" << pid << ",\"tid\":" << trace->tid << "}";
+            first = false;
+        }
+    }
+    // the counters as one sample at the end of the trace
+    for (int c = 0; c < CounterCount; ++c) {
+        quint64 total = 0;
+        for (const ThreadTrace *trace : qAsConst(r.threads))
+            total += trace->counters[c];
+        out << (first ? "" : ",\n")
+            << "{\"name\":\"" << counterNames[c]
+            << "\",\"cat\":\"qsourcehighlite\",\"ph\":\"C\",\"ts\":"
+            << QString::number(end / 1e3, 'f', 3)
+            << ",\"pid\":" << pid << ",\"args\":{\"value\":" << total << "}}";
+        first = false;
+    }
+    out << "\n]}\n";
+    out.flush();
+    return file.error() == QFileDevice::NoError;
+}
+
+QString QSourceHighliteTracer::summary()
+{
+    TraceRegistry &r = registry();
+    QMutexLocker lock(&r.mutex);
+
+    QString text;
+    QTextStream out(&text);
+    out << QStringLiteral("%1 %2 %3 %4\n")
+           .arg(QStringLiteral("phase"), -18)
+           .arg(QStringLiteral("ms"), 12)
+           .arg(QStringLiteral("calls"), 12)
+           .arg(QStringLiteral("ns/call"), 10);
+    for (int p = 0; p < PhaseCount; ++p) {
+        qint64 ns = 0;
+        quint64 calls = 0;
+        for (const ThreadTrace *trace : qAsConst(r.threads)) {
+            ns += trace->phaseNs[p];
+            calls += trace->phaseCalls[p];
+        }
+        out << QStringLiteral("%1 %2 %3 %4\n")
+               .arg(QLatin1String(phaseNames[p]), -18)
+               .arg(ns / 1e6, 12, 'f', 3)
+               .arg(calls, 12)
+               .arg(calls ? double(ns) / calls : 0.0, 10, 'f', 1);
+    }
+    quint64 dropped = 0;
+    for (int c = 0; c < CounterCount; ++c) {
+        quint64 total = 0;
+        for (const ThreadTrace *trace : qAsConst(r.threads)) {
+            total += trace->counters[c];
+            if (c == 0) dropped += trace->droppedEvents;
+        }
+        out << QStringLiteral("%1 %2\n").arg(QLatin1String(counterNames[c]), -18).arg(total, 12);
+    }
+    if (dropped)
+        out << dropped << " events not kept for the trace file, see setMaxEvents()\n";
+    out.flush();
+    return text;
+}
+
+#else
+
+void QSourceHighliteTracer::setEnabled(bool) {}
+bool QSourceHighliteTracer::isEnabled() { return false; }
+void QSourceHighliteTracer::setMaxEvents(int) {}
+void QSourceHighliteTracer::reset() {}
+void QSourceHighliteTracer::count(Counter, int) {}
+quint64 QSourceHighliteTracer::total(Counter) { return 0; }
+QSourceHighliteTracer::Scope::Scope(Phase phase) : _phase(phase), _start(-1) {}
+QSourceHighliteTracer::Scope::~Scope() {}
+
+bool QSourceHighliteTracer::writeChromeTrace(const QString &)
+{
+    return false;
+}
+
+QString QSourceHighliteTracer::summary()
+{
+    return QStringLiteral("tracing isn't compiled in, build with CONFIG += qsourcehighlite_trace\n");
+}
+
+#endif
+
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef QSOURCEHIGHLITETRACER_H
+#define QSOURCEHIGHLITETRACER_H
+
+#include <QString>
+
+namespace QSourceHighlite {
+
+/**
+ * @brief Timings and counters of the highlighting hot path
+ * @details Tracing is compiled in only with CONFIG += qsourcehighlite_trace,
+ * which defines QSOURCEHIGHLITE_TRACE. Without it the QSH_TRACE macros
+ * expand to nothing and the functions here do nothing. With it, it is off
+ * until setEnabled(true), which costs a relaxed atomic load per phase.
+ *
+ * Every thread records into its own buffers, so the worker threads of
+ * rehighlightParallel() are traced too. Phase times are inclusive, the
+ * main scan contains the literal and post-pass phases.
+ */
+class QSourceHighliteTracer
+{
+public:
+    enum Phase {
+        ResolveTables,
+        MainScan,
+        NumericLiterals,
+        StringLiterals,
+        CssPass,
+        YamlPass,
+        XmlPass,
+        MakePass,
+        AsmPass,
+        ApplyFormats,
+        PhaseCount
+    };
+
+    enum Counter {
+        BlocksHighlighted,
+        BlocksLexed,
+        // blocks whose cached spans were applied without lexing
+        CacheHits,
+        // blocks lexed again only because the previous block's state changed
+        CascadedBlocks,
+        WordsClassified,
+        SetFormatCalls,
+        CounterCount
+    };
+
+    static void setEnabled(bool enabled);
+    Q_REQUIRED_RESULT static bool isEnabled();
+
+    /**
+     * @brief how many phase events a thread keeps for the trace file,
+     * 100000 by default; the totals keep counting after that
+     */
+    static void setMaxEvents(int maxEvents);
+
+    /**
+     * @brief clears everything recorded so far, don't call it while
+     * highlighting
+     */
+    static void reset();
+
+    /**
+     * @brief writes the recorded phases and counters as a Chrome trace
+     * (chrome://tracing, Perfetto)
+     * @return false if the file can't be written
+     */
+    static bool writeChromeTrace(const QString &fileName);
+
+    /**
+     * @brief the total time and calls of every phase and the counters, as
+     * text
+     */
+    Q_REQUIRED_RESULT static QString summary();
+
+    static void count(Counter counter, int n = 1);
+
+    /**
+     * @brief the count of counter on all threads since reset(), 0 without
+     * tracing
+     */
+    Q_REQUIRED_RESULT static quint64 total(Counter counter);
+
+    /**
+     * @brief times a phase from construction to destruction
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Phase phase);
+        ~Scope();
+
+    private:
+        Q_DISABLE_COPY(Scope)
+        const Phase _phase;
+        const qint64 _start;
+    };
+};
+
+}
+
+#ifdef QSOURCEHIGHLITE_TRACE
+#define QSH_TRACE_CONCAT2(a, b) a##b
+#define QSH_TRACE_CONCAT(a, b) QSH_TRACE_CONCAT2(a, b)
+#define QSH_TRACE_SCOPE(phase) \
+    const QSourceHighlite::QSourceHighliteTracer::Scope QSH_TRACE_CONCAT(qshTraceScope, __LINE__)( \
+        QSourceHighlite::QSourceHighliteTracer::phase)
+#define QSH_TRACE_COUNT(counter, n) \
+    QSourceHighlite::QSourceHighliteTracer::count(QSourceHighlite::QSourceHighliteTracer::counter, n)
+#else
+#define QSH_TRACE_SCOPE(phase)
+#define QSH_TRACE_COUNT(counter, n)
+#endif
+
+#endif // QSOURCEHIGHLITETRACER_H
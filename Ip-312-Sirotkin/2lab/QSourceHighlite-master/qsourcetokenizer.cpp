@@ -0,0 +1,1645 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "qsourcetokenizer.h"
+#include "languageregistry.h"
+#include "textscanner.h"
+#include "qsourcehighlitetracer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace QSourceHighlite {
+
+/**
+ * @brief The few QString functions the lexer needs, on top of a QStringView
+ * @details QStringView has no indexOf() before Qt 5.14. Reading past the
+ * end gives a null QChar, like reading the terminator of a QString.
+ */
+class LineView
+{
+public:
+    explicit LineView(QStringView text)
+        : _data(text.data()), _size(int(text.size())) {}
+
+    int length() const { return _size; }
+    bool isEmpty() const { return _size == 0; }
+    const QChar *constData() const { return _data; }
+
+    QChar at(int i) const { return uint(i) < uint(_size) ? _data[i] : QChar(); }
+    QChar operator[](int i) const { return at(i); }
+
+    int indexOf(QChar c, int from = 0) const
+    {
+        if (from < 0) from = qMax(from + _size, 0);
+        for (int i = from; i < _size; ++i)
+            if (_data[i] == c) return i;
+        return -1;
+    }
+
+    int indexOf(QLatin1String s, int from = 0) const
+    {
+        if (from < 0) from = qMax(from + _size, 0);
+        for (int i = from; i + s.size() <= _size; ++i)
+            if (matchesAt(i, s)) return i;
+        return -1;
+    }
+
+    int lastIndexOf(QChar c, int from = -1) const
+    {
+        if (from < 0) from += _size;
+        if (uint(from) >= uint(_size)) return -1;
+        for (int i = from; i >= 0; --i)
+            if (_data[i] == c) return i;
+        return -1;
+    }
+
+    /**
+     * @brief returns true if s occurs at position i
+     */
+    bool matchesAt(int i, QLatin1String s) const
+    {
+        if (i < 0 || i + s.size() > _size) return false;
+        for (int k = 0; k < s.size(); ++k)
+            if (_data[i + k] != QLatin1Char(s.data()[k])) return false;
+        return true;
+    }
+
+    /**
+     * @brief same as QString::mid()
+     */
+    QStringView mid(int position, int n = -1) const
+    {
+        if (position > _size) return QStringView();
+        if (position < 0) {
+            if (n < 0 || n + position >= _size) return QStringView(_data, _size);
+            if (n + position <= 0) return QStringView();
+            n += position;
+            position = 0;
+        } else if (uint(n) > uint(_size - position)) {
+            n = _size - position;
+        }
+        return QStringView(_data + position, n);
+    }
+
+private:
+    const QChar *_data;
+    int _size;
+};
+
+/*
+ * What a character is to the lexer. Source text is almost all ASCII, so
+ * the first 128 code units are looked up here and only the rest goes
+ * through the Unicode tables of QChar.
+ */
+enum CharClass : quint8 {
+    Blank = 0x01,   // same as QChar::isSpace()
+    Alpha = 0x02,   // same as QChar::isLetter()
+    Digit = 0x04,   // same as QChar::isDigit() and QChar::isNumber()
+    Ident = 0x08    // letter, digit or '_', can be in a word
+};
+
+static const quint8 charClasses[128] = {
+    // 0x00 - 0x1f, tab to carriage return are whitespace
+    0, 0, 0, 0, 0, 0, 0, 0, 0, Blank, Blank, Blank, Blank, Blank, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    //   !  "  #  $  %  &  '  (  )  *  +  ,  -  .  /
+    Blank, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // 0 - 9  :  ;  <  =  >  ?
+    Digit|Ident, Digit|Ident, Digit|Ident, Digit|Ident, Digit|Ident,
+    Digit|Ident, Digit|Ident, Digit|Ident, Digit|Ident, Digit|Ident, 0, 0, 0, 0, 0, 0,
+    // @  A - O
+    0, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    // P - Z  [  \  ]  ^  _
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, 0, 0, 0, 0, Ident,
+    // `  a - o
+    0, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    // p - z  {  |  }  ~
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident, Alpha|Ident,
+    Alpha|Ident, Alpha|Ident, Alpha|Ident, 0, 0, 0, 0, 0
+};
+
+static inline bool isSpace(QChar c)
+{
+    return c.unicode() < 0x80 ? charClasses[c.unicode()] & Blank : c.isSpace();
+}
+
+static inline bool isLetter(QChar c)
+{
+    return c.unicode() < 0x80 ? charClasses[c.unicode()] & Alpha : c.isLetter();
+}
+
+static inline bool isNumber(QChar c)
+{
+    return c.unicode() < 0x80 ? charClasses[c.unicode()] & Digit : c.isNumber();
+}
+
+static inline bool isDigit(QChar c)
+{
+    return c.unicode() < 0x80 ? charClasses[c.unicode()] & Digit : c.isDigit();
+}
+
+/**
+ * @brief returns true if c can be part of a word, i.e. it is a letter, a
+ * number or '_'
+ */
+static inline bool isWordChar(QChar c)
+{
+    return c.unicode() < 0x80 ? charClasses[c.unicode()] & Ident : c.isLetterOrNumber();
+}
+
+/**
+ * @brief returns true if c is octal
+ */
+static constexpr inline bool isOctal(const char c) {
+    return (c >= '0' && c <= '7');
+}
+
+/**
+ * @brief returns true if c is hex
+ */
+static constexpr inline bool isHex(const char c) {
+    return (
+        (c >= '0' && c <= '9') ||
+        (c >= 'a' && c <= 'f') ||
+        (c >= 'A' && c <= 'F')
+    );
+}
+
+/*
+ * While a line is lexed, every character has a code: its Token in the low
+ * byte, TokenSpan flags in the next and, for color swatches, an index into
+ * _swatches in the upper half. Runs of equal codes become one span.
+ */
+static constexpr inline quint32 underlined(QSourceHighliter::Token token) {
+    return quint32(token) | (quint32(TokenSpan::Underline) << 8);
+}
+
+static constexpr inline quint32 swatch(quint8 flags, int index) {
+    return quint32(QSourceHighliter::CodeBlock) | (quint32(flags) << 8) |
+            (quint32(index) << 16);
+}
+
+// swatch() has 16 bits for the index, colors past the last one are
+// formatted as plain numbers
+static constexpr int maxSwatches = 0x10000;
+
+// where the parts of a state are, see QSourceTokenizer::tokenize()
+static constexpr int languageMask = 0xff;
+static constexpr int modeShift = 8;
+static constexpr int modeMask = 0xf;
+static constexpr int depthShift = 12;
+// a deeper nesting, bracket level or indentation is stored as depthMask,
+// which can't be undone, so the construct stays open from there on
+static constexpr int depthMask = 0xff;
+static constexpr int delimiterShift = 20;
+static constexpr int delimiterMask = 0xf;
+
+/**
+ * @brief the level of the Lua long bracket [[, [=[, [==[ ... at i, -1 if
+ * there is none
+ */
+static int longBracketLevel(const LineView &text, int i)
+{
+    if (text.at(i) != QLatin1Char('[')) return -1;
+    int k = i + 1;
+    while (text.at(k) == QLatin1Char('=')) ++k;
+    return text.at(k) == QLatin1Char('[') ? k - i - 1 : -1;
+}
+
+/**
+ * @brief the position after the first closing long bracket of level at or
+ * after from, -1 if there is none
+ */
+static int longBracketEnd(const LineView &text, int from, int level)
+{
+    for (int i = text.indexOf(QLatin1Char(']'), from); i != -1;
+         i = text.indexOf(QLatin1Char(']'), i + 1)) {
+        int k = i + 1;
+        while (text.at(k) == QLatin1Char('=')) ++k;
+        if (k - i - 1 == level && text.at(k) == QLatin1Char(']'))
+            return k + 1;
+    }
+    return -1;
+}
+
+/**
+ * @brief the position after the first """ or ''' at or after from, -1 if
+ * there is none
+ */
+static int tripleQuoteEnd(const LineView &text, int from, QChar quote)
+{
+    const int end = text.indexOf(quote == QLatin1Char('\'') ?
+                                     QLatin1String("'''") : QLatin1String("\"\"\""), from);
+    return end == -1 ? -1 : end + 3;
+}
+
+/**
+ * @brief returns true if a YAML line ends in a block scalar indicator,
+ * like "key: |" or "- >- # note", so that the more indented lines after
+ * it are text
+ */
+static bool opensBlockScalar(const LineView &text)
+{
+    // a comment may follow the indicator
+    int end = 0;
+    while (end < text.length() && !(text.at(end) == QLatin1Char('#') &&
+                                    (end == 0 || isSpace(text.at(end - 1)))))
+        ++end;
+    int i = end - 1;
+    while (i >= 0 && isSpace(text.at(i))) --i;
+    // chomping and indentation indicators
+    for (int k = 0; k < 2 && i > 0 && (text.at(i) == QLatin1Char('-') ||
+                                     text.at(i) == QLatin1Char('+') ||
+                                     isDigit(text.at(i))); ++k)
+        --i;
+    if (i < 0 || (text.at(i) != QLatin1Char('|') && text.at(i) != QLatin1Char('>')))
+        return false;
+    if (i == 0) return true;
+    if (text.at(i - 1) != QLatin1Char(' ')) return false;
+    int k = i - 1;
+    while (k >= 0 && text.at(k) == QLatin1Char(' ')) --k;
+    return k < 0 || text.at(k) == QLatin1Char(':') || text.at(k) == QLatin1Char('-');
+}
+
+/**
+ * @brief formats a string or comment that may go on over several lines
+ * @param end the position after its closing delimiter, -1 if it doesn't
+ * close on this line
+ * @return the position after it, textLen if it stays open, in which case
+ * the mode set by the caller is kept for the next line
+ */
+int QSourceTokenizer::formatConstruct(int start, int end, int textLen,
+                                      QSourceHighliter::Token token)
+{
+    if (end == -1) {
+        formatRun(start, textLen - start, token);
+        return textLen;
+    }
+    _mode = CodeMode;
+    _depth = 0;
+    _delimiter = 0;
+    formatRun(start, end - start, token);
+    return end;
+}
+
+/**
+ * @brief formats the part of the line that belongs to a construct opened
+ * on an earlier line
+ * @return where the code after it starts, textLen if it takes the whole
+ * line
+ */
+int QSourceTokenizer::highlightContinuation(const LineView &text)
+{
+    const int textLen = text.length();
+    switch (_mode) {
+    case CodeMode:
+        break;
+    case TripleQuoteMode: {
+        const QChar quote = QLatin1Char(_delimiter ? '\'' : '"');
+        return formatConstruct(0, tripleQuoteEnd(text, 0, quote), textLen,
+                               QSourceHighliter::CodeString);
+    }
+    case LongBracketMode:
+        return formatConstruct(0, _depth == depthMask ? -1 : longBracketEnd(text, 0, _depth),
+                               textLen,
+                               _delimiter ? QSourceHighliter::CodeComment :
+                                            QSourceHighliter::CodeString);
+    case ContinuedStringMode: {
+        const QChar quote = QLatin1Char(_delimiter ? '\'' : '"');
+        _mode = CodeMode;
+        _delimiter = 0;
+        return highlightStringBody(quote, text, 0);
+    }
+    case BlockScalarMode: {
+        int indent = 0;
+        while (indent < textLen && text.at(indent) == QLatin1Char(' ')) ++indent;
+        // blank lines don't end it
+        if (indent == textLen) return textLen;
+        if (indent > _depth || _depth == depthMask) {
+            formatRun(0, textLen, QSourceHighliter::CodeString);
+            return textLen;
+        }
+        _mode = CodeMode;
+        _depth = 0;
+        break;
+    }
+    }
+    return 0;
+}
+
+/**
+ * @brief the position of the end of the multi-line comment at from, -1 if
+ * it stays open
+ * @details from is either where the comment opens or the start of a line
+ * inside it. Where comments nest, _depth counts the open ones.
+ */
+int QSourceTokenizer::commentEnd(const LineView &text, int from)
+{
+    if (!(_compiledLanguage->flags & CompiledLanguage::NestedComments))
+        return text.indexOf(QLatin1String("*/"), from);
+
+    if (_state % 2 == 0)
+        _depth = 0;
+    else if (_depth == 0)
+        _depth = 1;
+    else if (_depth == depthMask)
+        return -1;
+    for (int k = from; k + 1 < text.length(); ++k) {
+        if (k >= _nextGuardCheck) checkGuard(k);
+        if (text.at(k) == QLatin1Char('/') && text.at(k + 1) == QLatin1Char('*')) {
+            ++_depth;
+            ++k;
+        } else if (text.at(k) == QLatin1Char('*') && text.at(k + 1) == QLatin1Char('/')) {
+            if (--_depth == 0) return k;
+            ++k;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Does the code syntax highlighting
+ * @param text
+ */
+void QSourceTokenizer::highlightSyntax(const LineView &text)
+{
+    QSH_TRACE_SCOPE(MainScan);
+    if (text.isEmpty()) {
+        // an empty line can't go on with a string
+        if (_mode == ContinuedStringMode) {
+            _mode = CodeMode;
+            _delimiter = 0;
+        }
+        return;
+    }
+
+    const auto textLen = text.length();
+
+    const CompiledLanguage &lang = *_compiledLanguage;
+    if (lang.flags & CompiledLanguage::IsXML) {
+        xmlHighlighter(text);
+        return;
+    }
+
+    const QChar comment = QLatin1Char(lang.comment);
+    const bool isSQL = lang.flags & CompiledLanguage::IsSQL;
+    const bool isLua = lang.flags & CompiledLanguage::LongBrackets;
+    const bool hasTripleQuotes = lang.flags & CompiledLanguage::TripleQuotes;
+    // Lua has no line comment character but long brackets start with '['
+    const char tokenChar = isLua ? '[' : lang.comment;
+    const KeywordTable &keywords = *lang.keywords;
+
+    const int start = highlightContinuation(text);
+    if (start >= textLen) return;
+
+    for (int i = start; i < textLen; ++i) {
+
+        if (_state % 2 != 0) goto Comment;
+
+        while (i < textLen) {
+            // jump over whitespace and punctuation
+            i = findTokenStart(text.constData(), i, textLen, tokenChar);
+            if (i >= _nextGuardCheck) checkGuard(i);
+            if (i == textLen) break;
+            if (isLetter(text[i])) {
+                if (!_degraded) break;
+                // words don't change the state, leave them plain
+                while (i < textLen && isWordChar(text[i])) ++i;
+                continue;
+            }
+
+            //inline comment
+            if (comment.isNull() && text[i] == QLatin1Char('/')) {
+                if((i+1) < textLen){
+                    if(text[i+1] == QLatin1Char('/')) {
+                        formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                        return;
+                    } else if(text[i+1] == QLatin1Char('*')) {
+                        Comment:
+                        //find a comment end after current position.
+                        int next = commentEnd(text, i);
+                        if (next == -1) {
+                            //we didn't find a comment end.
+                            //Check if we are already in a comment block
+                            if (_state % 2 == 0)
+                                _state = _state + 1;
+                            formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                            return;
+                        } else {
+                            //we found a comment end
+                            //mark this block as code if it was previously comment
+                            //first check if the comment ended on the same line
+                            //if modulo 2 is not equal to zero, it means we are in a comment
+                            //-1 will set this block's state as language
+                            if (_state % 2 != 0) {
+                                _state = _state - 1;
+                            }
+                            next += 2;
+                            formatRun(i, next - i, QSourceHighliter::CodeComment);
+                            i = next;
+                            if (i >= textLen) return;
+                        }
+                    }
+                }
+            } else if (isSQL && comment.isNull() && text[i] == QLatin1Char('-')) {
+                if((i+1) < textLen){
+                    if(text[i+1] == QLatin1Char('-')) {
+                        formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                        return;
+                    }
+                }
+            } else if (isLua && text[i] == QLatin1Char('-')) {
+                if (text[i+1] == QLatin1Char('-')) {
+                    const int level = longBracketLevel(text, i + 2);
+                    if (level == -1) {
+                        formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                        return;
+                    }
+                    _mode = LongBracketMode;
+                    _depth = level;
+                    _delimiter = 1;
+                    i = formatConstruct(i, longBracketEnd(text, i + level + 4, level),
+                                        textLen, QSourceHighliter::CodeComment);
+                }
+            } else if (isLua && text[i] == QLatin1Char('[')) {
+                const int level = longBracketLevel(text, i);
+                if (level != -1) {
+                    _mode = LongBracketMode;
+                    _depth = level;
+                    _delimiter = 0;
+                    i = formatConstruct(i, longBracketEnd(text, i + level + 2, level),
+                                        textLen, QSourceHighliter::CodeString);
+                }
+            } else if (text[i] == comment) {
+                formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                i = textLen;
+            //integer literal
+            } else if (isNumber(text[i])) {
+               i = highlightNumericLiterals(text, i);
+            //string literals
+            } else if (hasTripleQuotes && (text.matchesAt(i, QLatin1String("\"\"\"")) ||
+                                           text.matchesAt(i, QLatin1String("'''")))) {
+               _mode = TripleQuoteMode;
+               _delimiter = text[i] == QLatin1Char('\'');
+               i = formatConstruct(i, tripleQuoteEnd(text, i + 3, text[i]), textLen,
+                                   QSourceHighliter::CodeString);
+            } else if (text[i] == QLatin1Char('\"')) {
+               i = highlightStringLiterals('\"', text, i);
+            }  else if (text[i] == QLatin1Char('\'')) {
+               i = highlightStringLiterals('\'', text, i);
+            }
+            if (i >= textLen) {
+                break;
+            }
+            ++i;
+        }
+
+        if (i >= textLen || !isLetter(text[i])) continue;
+
+        // find the extent of the word once, then classify it with one lookup
+        const int start = i;
+        int end = i;
+        while (end < textLen && isWordChar(text[end]))
+            ++end;
+
+        // only whole words are classified
+        if (start == 0 || !isWordChar(text[start - 1])) {
+            WordClass wordClass = NoWord;
+            // macros like println!
+            if (end < textLen && text[end] == QLatin1Char('!') &&
+                (end + 1 == textLen || !isWordChar(text[end + 1]))) {
+                wordClass = keywords.classify(text.constData() + start, end + 1 - start);
+                if (wordClass != NoWord) ++end;
+            }
+            if (wordClass == NoWord)
+                wordClass = keywords.classify(text.constData() + start, end - start);
+            QSH_TRACE_COUNT(WordsClassified, 1);
+
+            switch (wordClass) {
+            case TypeWord:
+                formatRun(start, end - start, QSourceHighliter::CodeType);
+                break;
+            case KeyWord:
+                formatRun(start, end - start, QSourceHighliter::CodeKeyWord);
+                break;
+            case LiteralWord:
+                formatRun(start, end - start, QSourceHighliter::CodeNumLiteral);
+                break;
+            case BuiltInWord:
+                formatRun(start, end - start, QSourceHighliter::CodeBuiltIn);
+                break;
+            case OtherWord:
+                // preprocessor, highlight the '#' as well
+                _state == QSourceHighliter::CodeCpp ?
+                            formatRun(start - 1, end - start + 1, QSourceHighliter::CodeOther) :
+                            formatRun(start, end - start, QSourceHighliter::CodeOther);
+                break;
+            case NoWord:
+                break;
+            }
+        }
+
+        // the loop increments i, so stop on the last char of the word
+        i = end - 1;
+    }
+
+    // past the guard only the state matters, see setLongLineGuard()
+    if ((lang.flags & CompiledLanguage::IsCSS) && !_degraded) cssHighlighter(text);
+    if (lang.flags & CompiledLanguage::IsYAML) {
+        if (!_degraded) ymlHighlighter(text);
+        if (opensBlockScalar(text)) {
+            int indent = 0;
+            while (indent < textLen && text.at(indent) == QLatin1Char(' ')) ++indent;
+            _mode = BlockScalarMode;
+            _depth = qMin(indent, depthMask);
+        }
+    }
+    if (_degraded) return;
+    if (lang.flags & CompiledLanguage::IsMake) makeHighlighter(text);
+    if (lang.flags & CompiledLanguage::IsAsm)  asmHighlighter(text);
+}
+
+/**
+ * @brief returns true if the count characters from i are hex digits
+ */
+static bool isHexRun(const LineView &text, int i, int count)
+{
+    if (i + count > text.length()) return false;
+    for (int k = i; k < i + count; ++k)
+        if (!isHex(text.at(k).toLatin1())) return false;
+    return true;
+}
+
+/**
+ * @brief returns the length of the escape sequence starting with the
+ * backslash at i, or 0 if it isn't one
+ * @details Knows the C escapes, \\ooo octal, \\xhh hex and the \\uhhhh,
+ * \\Uhhhhhhhh and \\u{h...} Unicode escapes.
+ */
+static int escapeLength(const LineView &text, int i)
+{
+    switch (text.at(i + 1).toLatin1()) {
+    case 'a':
+    case 'b':
+    case 'e':
+    case 'f':
+    case 'n':
+    case 'r':
+    case 't':
+    case 'v':
+    case '\'':
+    case '"':
+    case '\\':
+    case '\?':
+        //2 because we have to highlight \ as well as the following char
+        return 2;
+    //octal esc sequence \123
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+        return isOctal(text.at(i + 2).toLatin1()) &&
+                isOctal(text.at(i + 3).toLatin1()) ? 4 : 0;
+    //hex numbers \xFA
+    case 'x':
+        return isHexRun(text, i + 2, 2) ? 4 : 0;
+    //unicode code points \u00e9, \u{1F600} and \U0001F600
+    case 'u':
+        if (text.at(i + 2) == QLatin1Char('{')) {
+            int end = i + 3;
+            while (end < i + 9 && isHex(text.at(end).toLatin1())) ++end;
+            return end > i + 3 && text.at(end) == QLatin1Char('}') ? end + 1 - i : 0;
+        }
+        return isHexRun(text, i + 2, 4) ? 6 : 0;
+    case 'U':
+        return isHexRun(text, i + 2, 8) ? 10 : 0;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Highlight string literals in code
+ * @param strType str type i.e., ' or "
+ * @param text the text being scanned
+ * @param i pos of i in loop
+ * @return pos of i after the string
+ */
+int QSourceTokenizer::highlightStringLiterals(const QChar strType, const LineView &text, int i) {
+    formatRun(i, 1, QSourceHighliter::CodeString);
+    return highlightStringBody(strType, text, i + 1);
+}
+
+/**
+ * @brief Highlight the rest of a string literal, from after its opening
+ * quote or from the start of a line it goes on to
+ * @return pos of i after the string
+ */
+int QSourceTokenizer::highlightStringBody(const QChar strType, const LineView &text, int i) {
+    QSH_TRACE_SCOPE(StringLiterals);
+    const int textLen = text.length();
+    while (i < textLen) {
+        //everything up to the next quote or backslash is plain string
+        const int next = findQuoteOrEscape(text.constData(), i, textLen, strType);
+        formatRun(i, next - i, QSourceHighliter::CodeString);
+        i = next;
+        if (i >= _nextGuardCheck) checkGuard(i);
+        if (i == textLen) break;
+
+        //string end
+        if (text.at(i) == strType) {
+            formatRun(i, 1, QSourceHighliter::CodeString);
+            return i + 1;
+        }
+
+        //a backslash ending the line continues the string on the next one
+        if (i + 1 == textLen) {
+            if (_compiledLanguage->flags & CompiledLanguage::ContinuedStrings) {
+                _mode = ContinuedStringMode;
+                _delimiter = strType == QLatin1Char('\'');
+            }
+            formatRun(i, 1, QSourceHighliter::CodeString);
+            return textLen;
+        }
+
+        //a backslash always escapes the next character, even if it isn't
+        //an escape sequence we highlight, so "\\" ends at the second quote
+        const int len = escapeLength(text, i);
+        if (len == 0) {
+            formatRun(i, 2, QSourceHighliter::CodeString);
+            i += 2;
+        } else {
+            formatRun(i, len, QSourceHighliter::CodeNumLiteral);
+            i += len;
+        }
+    }
+    return i;
+}
+
+/*
+ * What a character can be in or around a number. Numbers are plain ASCII,
+ * so everything from 0x80 up has no class.
+ */
+enum NumberClass : quint8 {
+    Dg = 0x01,  // decimal digit
+    Hx = 0x02,  // hex digit letter
+    Sp = 0x04,  // digit separator, as in 1'000 or 1_000
+    Wd = 0x08,  // can be part of a suffix
+    Bf = 0x10,  // can come before a number
+    Af = 0x20,  // can come after a number
+    Nm = 0x40   // can be in a number after its first digit, with Dg and Hx
+};
+
+static const quint8 numberClasses[256] = {
+    // 0x00 - 0x1f, only tab
+    0, 0, 0, 0, 0, 0, 0, 0, 0, Bf|Af, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    //   !  "  #  $  %  &  '  (  )  *  +  ,  -  .  /
+    Bf|Af, Bf, 0, 0, 0, Bf|Af, Bf|Af, Sp|Nm, Bf, Af, Bf|Af, Bf|Af|Nm, Bf|Af, Bf|Af|Nm, Nm, Bf|Af,
+    // 0 - 9  :  ;  <  =  >  ?
+    Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Dg|Wd, Bf|Af, Bf|Af, Bf|Af, Bf|Af, Bf|Af, Bf|Af,
+    // @  A - O
+    0, Hx|Wd, Hx|Wd|Nm, Hx|Wd, Hx|Wd, Hx|Wd|Nm, Hx|Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd|Nm,
+    // P - Z  [  \  ]  ^  _
+    Wd|Nm, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd|Nm, Wd, Wd, Bf, 0, Af, Bf|Af, Sp|Wd|Nm,
+    // `  a - o
+    0, Hx|Wd, Hx|Wd|Nm, Hx|Wd, Hx|Wd, Hx|Wd|Nm, Hx|Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd|Nm,
+    // p - z  {  |  }  ~
+    Wd|Nm, Wd, Wd, Wd, Wd, Wd, Wd, Wd, Wd|Nm, Wd, Wd, Bf, Bf|Af, Af, Bf, 0
+};
+
+static inline quint8 numberClass(QChar c)
+{
+    return c.unicode() < 256 ? numberClasses[c.unicode()] : 0;
+}
+
+static inline bool isDigitOf(int base, QChar c)
+{
+    const quint8 cls = numberClass(c);
+    if (base == 16) return cls & (Dg | Hx);
+    return (cls & Dg) && c.unicode() - '0' < ushort(base);
+}
+
+/**
+ * @brief returns true if text[from, to) is a valid suffix of a number in a
+ * language, e.g. the UL of 10UL
+ */
+static bool isNumberSuffix(const LineView &text, int from, int to,
+                           CompiledLanguage::NumberSuffixes suffixes)
+{
+    const int len = to - from;
+    if (len == 0) return true;
+
+    const auto is = [&text, from, len](const char *s) {
+        return int(std::strlen(s)) == len && text.matchesAt(from, QLatin1String(s, len));
+    };
+    // c is one of chars
+    const auto isOneOf = [](QChar c, const char *chars) {
+        return c.unicode() < 0x80 && c.unicode() != 0 &&
+               std::strchr(chars, c.toLatin1()) != nullptr;
+    };
+
+    switch (suffixes) {
+    case CompiledLanguage::CSuffixes:
+        // 10UL, 1.0f, 2.5m in C#, 10n in JavaScript
+        if (len > 3) return false;
+        for (int k = from; k < to; ++k)
+            if (!isOneOf(text.at(k), "uUlLfFdDmMn")) return false;
+        return true;
+    case CompiledLanguage::NoSuffixes:
+        return false;
+    case CompiledLanguage::RustSuffixes: {
+        // 10u8, 1_000i64, 1.5f32, also after a separator as in 10_u8
+        const int type = text.at(from) == QLatin1Char('_') ? from + 1 : from;
+        if (type == to) return false;
+        const QChar kind = text.at(type);
+        const auto bitsAre = [&text, type, to](const char *bits) {
+            const int n = int(std::strlen(bits));
+            return to - type - 1 == n && text.matchesAt(type + 1, QLatin1String(bits, n));
+        };
+        if (kind == QLatin1Char('f'))
+            return bitsAre("32") || bitsAre("64");
+        if (kind != QLatin1Char('u') && kind != QLatin1Char('i')) return false;
+        return bitsAre("8") || bitsAre("16") || bitsAre("32") || bitsAre("64") ||
+               bitsAre("128") || bitsAre("size");
+    }
+    case CompiledLanguage::PythonSuffixes:
+        // imaginary numbers
+        return is("j") || is("J");
+    case CompiledLanguage::CssUnits:
+        return is("px") || is("em") || is("rem") || is("ex") || is("ch") ||
+               is("vh") || is("vw") || is("vmin") || is("vmax") ||
+               is("pt") || is("pc") || is("cm") || is("mm") || is("in") ||
+               is("deg") || is("rad") || is("turn") || is("s") || is("ms") ||
+               is("fr") || is("dpi") || is("dppx") || is("x");
+    case CompiledLanguage::AsmSuffixes: {
+        // 0FFh, 1010b, 17o, 17q, 10d. The digits before a h may be hex
+        // letters, they are part of the suffix then.
+        const QChar last = text.at(to - 1);
+        for (int k = from; k < to - 1; ++k)
+            if (!isDigitOf(16, text.at(k))) return false;
+        if (last == QLatin1Char('h') || last == QLatin1Char('H')) return true;
+        return len == 1 && isOneOf(last, "bBoOqQdD");
+    }
+    }
+    return false;
+}
+
+/**
+ * @brief Highlight number literals in code
+ * @param text the text being scanned
+ * @param i pos of i in loop
+ * @return pos of the last character looked at, the caller goes on after it
+ * @details One forward pass over the number with a small DFA: decimal with
+ * an optional fraction and exponent, 0x hex with an optional hex float
+ * fraction and p exponent, 0b binary and 0o octal. A separator is part of
+ * the number only between two digits. A number is highlighted if it is
+ * followed by a suffix of the language and then an operator, a bracket,
+ * a space or the end of the line.
+ */
+int QSourceTokenizer::highlightNumericLiterals(const LineView &text, int i)
+{
+    QSH_TRACE_SCOPE(NumericLiterals);
+    const int textLen = text.length();
+    const int start = i;
+    const int flags = _compiledLanguage->flags;
+
+    if (!(numberClass(text.at(i)) & Dg)) return i;
+    if (i > 0) {
+        const QChar before = text.at(i - 1);
+        bool isPreAllowed = numberClass(before) & Bf;
+        // $10 in AT&T syntax, the end of a range as in 0..10
+        if (before == QLatin1Char('$'))
+            isPreAllowed = flags & CompiledLanguage::IsAsm;
+        else if (before == QLatin1Char('.'))
+            isPreAllowed = text.at(i - 2) == QLatin1Char('.');
+        if (!isPreAllowed) return i;
+    }
+
+    enum State {
+        Integer,    // 12
+        Fraction,   // 12.5, also 1.2.3 as in versions
+        ExpSign,    // 1e, 1e-
+        Exponent,   // 1e5
+        Prefix,     // 0x, 0b, 0o
+        Digits,     // 0x1f, 0b101, 0o17
+        HexFraction,// 0x1.8
+        Stop
+    };
+
+    // ' separates digits only in C++, elsewhere it starts a string
+    const bool quoteSeparates = _compiledLanguage->flags & CompiledLanguage::DigitQuotes;
+    const auto isSeparator = [quoteSeparates](QChar c) {
+        return (numberClass(c) & Sp) && (quoteSeparates || c != QLatin1Char('\''));
+    };
+
+    State state = Integer;
+    int base = 10;
+    // the end of the longest valid number so far
+    int end = ++i;
+    const QChar *data = text.constData();
+    for (; i < textLen && state != Stop; ++i) {
+        const QChar c = data[i];
+        const quint8 cls = numberClass(c);
+        // most characters are digits or end the number, decide those
+        // without looking further
+        if ((cls & Dg) && state != ExpSign && base == 10) {
+            end = i + 1;
+            continue;
+        }
+        if (!(cls & (Dg | Hx | Nm)))
+            break;
+        const QChar next = text.at(i + 1);
+        switch (state) {
+        case Integer:
+        case Fraction:
+            if (cls & Dg) {
+                end = i + 1;
+            } else if (isSeparator(c) && isDigitOf(10, next)) {
+                // a separator between digits
+            } else if (c == QLatin1Char('.') && isDigitOf(10, next)) {
+                state = Fraction;
+            } else if (state == Integer && c == QLatin1Char('.') && next != QLatin1Char('.') &&
+                       !(numberClass(next) & Wd)) {
+                // 1. is a float, but 0..10 is a range and 1.max() a call
+                state = Fraction;
+                end = i + 1;
+            } else if ((c == QLatin1Char('e') || c == QLatin1Char('E')) &&
+                       (isDigitOf(10, next) || next == QLatin1Char('+') || next == QLatin1Char('-'))) {
+                state = ExpSign;
+            } else if (i == start + 1 && text.at(start) == QLatin1Char('0') &&
+                       (c == QLatin1Char('x') || c == QLatin1Char('X'))) {
+                state = Prefix;
+                base = 16;
+            } else if (i == start + 1 && text.at(start) == QLatin1Char('0') &&
+                       (c == QLatin1Char('b') || c == QLatin1Char('B')) && isDigitOf(2, next)) {
+                state = Prefix;
+                base = 2;
+            } else if (i == start + 1 && text.at(start) == QLatin1Char('0') &&
+                       (c == QLatin1Char('o') || c == QLatin1Char('O')) && isDigitOf(8, next)) {
+                state = Prefix;
+                base = 8;
+            } else {
+                state = Stop;
+            }
+            break;
+        case ExpSign:
+            if (cls & Dg) {
+                state = Exponent;
+                end = i + 1;
+            } else if ((c == QLatin1Char('+') || c == QLatin1Char('-')) && isDigitOf(10, next) &&
+                       (numberClass(text.at(i - 1)) & Wd)) {
+                // the sign right after the e or p
+            } else {
+                state = Stop;
+            }
+            break;
+        case Exponent:
+            if (cls & Dg)
+                end = i + 1;
+            else if (!(isSeparator(c) && isDigitOf(10, next)))
+                state = Stop;
+            break;
+        case Prefix:
+        case Digits:
+        case HexFraction:
+            if (isDigitOf(base, c)) {
+                state = state == Prefix ? Digits : state;
+                end = i + 1;
+            } else if (state == Digits && isSeparator(c) && isDigitOf(base, next)) {
+                // a separator between digits
+            } else if (base == 16 && state != HexFraction && c == QLatin1Char('.') &&
+                       (isDigitOf(16, next) || next == QLatin1Char('p') || next == QLatin1Char('P'))) {
+                state = HexFraction;
+            } else if (base == 16 && state != Prefix && (c == QLatin1Char('p') || c == QLatin1Char('P')) &&
+                       (isDigitOf(10, next) || next == QLatin1Char('+') || next == QLatin1Char('-'))) {
+                state = ExpSign;
+            } else {
+                state = Stop;
+            }
+            break;
+        case Stop:
+            break;
+        }
+    }
+
+    // the suffix is the rest of the word, it must fit the language
+    int suffixEnd = end;
+    while (suffixEnd < textLen && (numberClass(text.at(suffixEnd)) & Wd))
+        ++suffixEnd;
+
+    bool isPostAllowed = end == suffixEnd || isNumberSuffix(text, end, suffixEnd,
+                                        CompiledLanguage::NumberSuffixes(_compiledLanguage->numberSuffixes));
+    if (isPostAllowed && suffixEnd < textLen) {
+        const QChar after = text.at(suffixEnd);
+        // 0..10 is a range
+        isPostAllowed = (numberClass(after) & Af) ||
+                        (after == QLatin1Char('.') && text.at(suffixEnd + 1) == QLatin1Char('.'));
+    }
+
+    if (isPostAllowed)
+        formatRun(start, suffixEnd - start, QSourceHighliter::CodeNumLiteral);
+    // skip the whole word either way, so its digits aren't taken for
+    // another number
+    return suffixEnd - 1;
+}
+
+/**
+ * @brief returns true if c starts or ends a flow collection or separates
+ * its entries
+ */
+static inline bool isYamlFlowIndicator(QChar c)
+{
+    return c == QLatin1Char(',') || c == QLatin1Char('[') || c == QLatin1Char(']') ||
+            c == QLatin1Char('{') || c == QLatin1Char('}');
+}
+
+/**
+ * @brief The YAML highlighter
+ * @param text
+ * @details This function post processes a line after the main syntax
+ * highlighter has run for additional highlighting. It goes over the line
+ * once, token by token:
+ *
+ * Plain scalars with a colon and a space after them are keys, so are
+ * the ones in flow collections like {a: 1}. Quoted scalars are skipped,
+ * and so is a colon in a path (C:\).
+ *
+ * Anchors (&a) and aliases (*a) are builtins, tags (!!str) types and
+ * block scalar indicators (| and >-) other.
+ *
+ * Words starting with http:// or https:// are highlighted as a link
+ * (underlined), up to the next space.
+ *
+ * The rest of the line after a # with a space before it is a comment.
+ */
+void QSourceTokenizer::ymlHighlighter(const LineView &text) {
+    QSH_TRACE_SCOPE(YamlPass);
+    const int textLen = text.length();
+    // nesting of [] and {}, inside them ',' ends a scalar
+    int flowDepth = 0;
+
+    int i = 0;
+    while (i < textLen) {
+        const QChar c = text.at(i);
+        const QChar next = text.at(i + 1);
+        const bool isIndicator = i + 1 == textLen || isSpace(next);
+
+        if (isSpace(c)) {
+            ++i;
+        } else if (c == QLatin1Char('#')) {
+            //a comment, a # inside a scalar is part of it
+            return;
+        } else if (c == QLatin1Char('"') || c == QLatin1Char('\'')) {
+            //quoted scalars, with \" and '' escapes
+            ++i;
+            while (i < textLen) {
+                if (c == QLatin1Char('"') && text.at(i) == QLatin1Char('\\')) {
+                    i += 2;
+                } else if (text.at(i) == c) {
+                    if (c == QLatin1Char('\'') && text.at(i + 1) == c) {
+                        i += 2;
+                    } else {
+                        ++i;
+                        break;
+                    }
+                } else {
+                    ++i;
+                }
+            }
+        } else if (isYamlFlowIndicator(c)) {
+            if (c == QLatin1Char('[') || c == QLatin1Char('{'))
+                ++flowDepth;
+            else if (c != QLatin1Char(',') && flowDepth > 0)
+                --flowDepth;
+            ++i;
+        } else if ((c == QLatin1Char('-') || c == QLatin1Char('?') || c == QLatin1Char(':')) &&
+                   isIndicator) {
+            //sequence entries and explicit keys and values
+            ++i;
+        } else if ((c == QLatin1Char('&') || c == QLatin1Char('*') || c == QLatin1Char('!')) &&
+                   !isIndicator) {
+            const int start = i;
+            while (i < textLen && !isSpace(text.at(i)) &&
+                   !(flowDepth > 0 && isYamlFlowIndicator(text.at(i))))
+                ++i;
+            formatRun(start, i - start, c == QLatin1Char('!') ? QSourceHighliter::CodeType :
+                                                                 QSourceHighliter::CodeBuiltIn);
+        } else if (c == QLatin1Char('|') || c == QLatin1Char('>')) {
+            //block scalar indicators like |, >- and |2+
+            const int start = i++;
+            while (i < textLen && (text.at(i) == QLatin1Char('-') ||
+                                   text.at(i) == QLatin1Char('+') || isDigit(text.at(i))))
+                ++i;
+            if (i == textLen || isSpace(text.at(i)))
+                formatRun(start, i - start, QSourceHighliter::CodeOther);
+        } else {
+            //a plain scalar, a key if it ends in a colon
+            const int start = i;
+            for (; i < textLen; ++i) {
+                const QChar ch = text.at(i);
+                if (ch == QLatin1Char(':')) {
+                    const QChar after = text.at(i + 1);
+                    if (i + 1 == textLen || isSpace(after) ||
+                            (flowDepth > 0 && isYamlFlowIndicator(after)))
+                        break;
+                } else if (isSpace(ch)) {
+                    if (text.at(i + 1) == QLatin1Char('#')) break;
+                } else if (flowDepth > 0 && isYamlFlowIndicator(ch)) {
+                    break;
+                } else if (ch == QLatin1Char('h') && (i == start || isSpace(text.at(i - 1))) &&
+                           (text.matchesAt(i, QLatin1String("http://")) ||
+                            text.matchesAt(i, QLatin1String("https://")))) {
+                    const int link = i;
+                    while (i + 1 < textLen && !isSpace(text.at(i + 1))) ++i;
+                    formatRun(link, i + 1 - link, underlined(QSourceHighliter::CodeString));
+                }
+            }
+            if (i < textLen && text.at(i) == QLatin1Char(':')) {
+                int end = i;
+                while (isSpace(text.at(end - 1))) --end;
+                formatRun(start, end - start, QSourceHighliter::CodeKeyWord);
+                ++i;
+            }
+        }
+    }
+}
+
+static inline int hexValue(ushort c)
+{
+    return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+}
+
+/**
+ * @brief reads a number like 12, -.5, 50% or 120deg at i and moves i past
+ * it
+ * @param percent set to true if the number ends in '%'
+ * @return false if there is no number at i
+ */
+static bool readCssNumber(QStringView s, int &i, double &value, bool &percent)
+{
+    const int len = int(s.size());
+    bool negative = false;
+    if (i < len && (s.at(i) == QLatin1Char('-') || s.at(i) == QLatin1Char('+')))
+        negative = s.at(i++) == QLatin1Char('-');
+    const int start = i;
+    double v = 0;
+    while (i < len && isDigitOf(10, s.at(i)))
+        v = v * 10 + (s.at(i++).unicode() - '0');
+    if (i < len && s.at(i) == QLatin1Char('.')) {
+        ++i;
+        double scale = 0.1;
+        for (; i < len && isDigitOf(10, s.at(i)); ++i, scale /= 10)
+            v += (s.at(i).unicode() - '0') * scale;
+    }
+    if (i == start || (i == start + 1 && s.at(start) == QLatin1Char('.')))
+        return false;
+    percent = i < len && s.at(i) == QLatin1Char('%');
+    if (percent) {
+        ++i;
+    } else {
+        // units such as deg or turn are taken as the default unit
+        while (i < len && isLetter(s.at(i))) ++i;
+    }
+    value = negative ? -v : v;
+    return true;
+}
+
+/**
+ * @brief parses a css color: a name, #rgb, #rgba, #rrggbb, #rrggbbaa,
+ * rgb(), rgba(), hsl() or hsla()
+ * @details Reads the text in place, only names go through QColor.
+ * @return false if s isn't a color
+ */
+static bool parseCssColor(QStringView s, QRgb *rgb)
+{
+    const int len = int(s.size());
+    if (len == 0) return false;
+
+    if (s.at(0) == QLatin1Char('#')) {
+        const int digits = len - 1;
+        if (digits != 3 && digits != 4 && digits != 6 && digits != 8) return false;
+        for (int k = 1; k < len; ++k)
+            if (!isDigitOf(16, s.at(k))) return false;
+        // #rgb is short for #rrggbb
+        const bool isShort = digits < 6;
+        int channels[4] = {0, 0, 0, 255};
+        for (int k = 0; k < (isShort ? digits : digits / 2); ++k) {
+            channels[k] = isShort ? hexValue(s.at(1 + k).unicode()) * 17 :
+                                    hexValue(s.at(1 + 2 * k).unicode()) * 16 +
+                                    hexValue(s.at(2 + 2 * k).unicode());
+        }
+        *rgb = qRgba(channels[0], channels[1], channels[2], channels[3]);
+        return true;
+    }
+
+    const bool isRgb = s.startsWith(QLatin1String("rgb"), Qt::CaseInsensitive);
+    if (isRgb || s.startsWith(QLatin1String("hsl"), Qt::CaseInsensitive)) {
+        int i = 3;
+        if (i < len && (s.at(i).unicode() | 0x20) == 'a') ++i;
+        if (i == len || s.at(i) != QLatin1Char('(')) return false;
+        ++i;
+        // both rgb(1, 2, 3, 0.5) and rgb(1 2 3 / 50%)
+        double values[4] = {0, 0, 0, 1};
+        bool percents[4] = {};
+        int count = 0;
+        for (;;) {
+            while (i < len && (isSpace(s.at(i)) || s.at(i) == QLatin1Char(',') ||
+                               s.at(i) == QLatin1Char('/')))
+                ++i;
+            if (i < len && s.at(i) == QLatin1Char(')')) break;
+            if (count == 4 || !readCssNumber(s, i, values[count], percents[count]))
+                return false;
+            ++count;
+        }
+        if (count < 3 || i + 1 != len) return false;
+
+        const auto unit = [&values, &percents](int k, double max) {
+            const double v = percents[k] ? values[k] / 100 : values[k] / max;
+            return qBound(0.0, v, 1.0);
+        };
+        const double alpha = unit(3, 1);
+        if (isRgb) {
+            *rgb = qRgba(qRound(unit(0, 255) * 255), qRound(unit(1, 255) * 255),
+                         qRound(unit(2, 255) * 255), qRound(alpha * 255));
+        } else {
+            double hue = std::fmod(values[0], 360);
+            if (hue < 0) hue += 360;
+            // saturation and lightness are percentages even without the '%'
+            percents[1] = percents[2] = true;
+            *rgb = QColor::fromHslF(hue / 360, unit(1, 1), unit(2, 1), alpha).rgba();
+        }
+        return true;
+    }
+
+    QColor c;
+    c.setNamedColor(s);
+    if (!c.isValid()) return false;
+    *rgb = c.rgba();
+    return true;
+}
+
+/**
+ * @brief Highlights selectors and color values in one pass over the line
+ * @details The value of a color property is drawn on a swatch of its
+ * color. A rgb() or hsl() color that can't be parsed gets a swatch on the
+ * default background.
+ */
+void QSourceTokenizer::cssHighlighter(const LineView &text)
+{
+    QSH_TRACE_SCOPE(CssPass);
+    const int textLen = text.length();
+    int i = 0;
+    while (i < textLen) {
+        const QChar c = text.at(i);
+        if (c == QLatin1Char('.') || c == QLatin1Char('#')) {
+            //class and id selectors, not numbers like .5em
+            const QChar next = text.at(i + 1);
+            if (i + 1 == textLen || isSpace(next) || isNumber(next)) {
+                ++i;
+                continue;
+            }
+            int end = i + 1;
+            while (end < textLen && !isSpace(text.at(end)) && text.at(end) != QLatin1Char('{'))
+                ++end;
+            formatRun(i, end - i, QSourceHighliter::CodeKeyWord);
+            i = end;
+        } else if (c == QLatin1Char('c') && text.matchesAt(i, QLatin1String("color"))) {
+            //color, background-color, border-color...
+            i += 5;
+            while (i < textLen && isSpace(text.at(i))) ++i;
+            if (text.at(i) != QLatin1Char(':')) continue;
+            ++i;
+            while (i < textLen && isSpace(text.at(i))) ++i;
+
+            //the value ends at ';', '}' or !important
+            const int start = i;
+            while (i < textLen && text.at(i) != QLatin1Char(';') &&
+                   text.at(i) != QLatin1Char('}') && text.at(i) != QLatin1Char('!'))
+                ++i;
+            int end = i;
+            while (end > start && isSpace(text.at(end - 1))) --end;
+
+            if (_swatches.size() == maxSwatches) {
+                formatRun(start, end - start, QSourceHighliter::CodeNumLiteral);
+                continue;
+            }
+            const QStringView color = text.mid(start, end - start);
+            quint8 flags = TokenSpan::ColorSwatch;
+            QRgb rgb = 0;
+            if (!parseCssColor(color, &rgb)) {
+                if (!color.startsWith(QLatin1String("rgb"), Qt::CaseInsensitive) &&
+                        !color.startsWith(QLatin1String("hsl"), Qt::CaseInsensitive))
+                    continue;
+                flags |= TokenSpan::DefaultBackground;
+            }
+            _swatches.append(rgb);
+            formatRun(start, end - start, swatch(flags, _swatches.size() - 1));
+        } else {
+            ++i;
+        }
+    }
+}
+
+/**
+ * @brief returns true if c can be part of an XML tag or attribute name
+ */
+static inline bool isXmlNameChar(QChar c)
+{
+    return isWordChar(c) || c == QLatin1Char(':') || c == QLatin1Char('-') ||
+            c == QLatin1Char('.');
+}
+
+/**
+ * @brief Highlights XML and HTML in one pass over the line
+ * @details Tag names are keywords and attribute names builtins. Tags,
+ * attribute values, <!-- --> comments and CDATA sections can go on over
+ * line breaks, the mode and the comment bit of the state carry them to
+ * the next line.
+ */
+void QSourceTokenizer::xmlHighlighter(const LineView &text) {
+    QSH_TRACE_SCOPE(XmlPass);
+    const int textLen = text.length();
+
+    int i = 0;
+    while (i < textLen) {
+        if (_state % 2 != 0) {
+            //inside a comment
+            const int end = text.indexOf(QLatin1String("-->"), i);
+            if (end == -1) {
+                formatRun(i, textLen - i, QSourceHighliter::CodeComment);
+                return;
+            }
+            formatRun(i, end + 3 - i, QSourceHighliter::CodeComment);
+            _state = _state - 1;
+            i = end + 3;
+        } else if (_mode == XmlCDataMode) {
+            const int end = text.indexOf(QLatin1String("]]>"), i);
+            i = formatConstruct(i, end == -1 ? -1 : end + 3, textLen,
+                                QSourceHighliter::CodeString);
+        } else if (_mode == XmlTagMode) {
+            if (_delimiter != 0) {
+                //attribute value, the opening quote may be on an earlier line
+                const int end = text.indexOf(QLatin1Char(_delimiter == 1 ? '"' : '\''), i);
+                const int next = end == -1 ? textLen : end + 1;
+                formatRun(i, next - i, QSourceHighliter::CodeString);
+                if (end != -1) _delimiter = 0;
+                i = next;
+                continue;
+            }
+            const QChar c = text.at(i);
+            if (c == QLatin1Char('>')) {
+                _mode = CodeMode;
+                ++i;
+            } else if (c == QLatin1Char('<')) {
+                //unclosed tag, start over with the next one
+                _mode = CodeMode;
+            } else if (c == QLatin1Char('"') || c == QLatin1Char('\'')) {
+                _delimiter = c == QLatin1Char('"') ? 1 : 2;
+                formatRun(i, 1, QSourceHighliter::CodeString);
+                ++i;
+            } else if (isXmlNameChar(c)) {
+                const int start = i;
+                while (i < textLen && isXmlNameChar(text.at(i))) ++i;
+                formatRun(start, i - start, QSourceHighliter::CodeBuiltIn);
+            } else {
+                //whitespace, '=', '/' or '?'
+                ++i;
+            }
+        } else {
+            //text between tags
+            i = text.indexOf(QLatin1Char('<'), i);
+            if (i == -1) return;
+            if (text.matchesAt(i, QLatin1String("<!--"))) {
+                _state = _state + 1;
+                formatRun(i, 4, QSourceHighliter::CodeComment);
+                i += 4;
+            } else if (text.matchesAt(i, QLatin1String("<![CDATA["))) {
+                _mode = XmlCDataMode;
+                formatRun(i, 9, QSourceHighliter::CodeString);
+                i += 9;
+            } else {
+                //</tag, <?xml and <!DOCTYPE
+                int name = i + 1;
+                const QChar c = text.at(name);
+                if (c == QLatin1Char('/') || c == QLatin1Char('?') || c == QLatin1Char('!'))
+                    ++name;
+                int end = name;
+                while (end < textLen && isXmlNameChar(text.at(end))) ++end;
+                if (end == name) {
+                    //a lone '<'
+                    ++i;
+                    continue;
+                }
+                formatRun(name, end - name, QSourceHighliter::CodeKeyWord);
+                _mode = XmlTagMode;
+                i = end;
+            }
+        }
+    }
+}
+
+void QSourceTokenizer::makeHighlighter(const LineView &text)
+{
+    QSH_TRACE_SCOPE(MakePass);
+    int colonPos = text.indexOf(QLatin1Char(':'));
+    if (colonPos == -1)
+        return;
+    formatRun(0, colonPos, QSourceHighliter::CodeBuiltIn);
+}
+
+static constexpr inline quint32 ccBit(char c) {
+    return 1u << (c - 'a' + 1);
+}
+
+/*
+ * The x86 condition codes as a bitset: bit 0 of conditionCodes[a] is set if
+ * the letter a alone is a condition code, the bit ccBit(b) if ab is one.
+ * "j" followed by a condition code is a conditional jump, "jmp" is in here
+ * too.
+ */
+static const quint32 conditionCodes[26] = {
+    /* a */ 1 | ccBit('e'),
+    /* b */ 1 | ccBit('e'),
+    /* c */ 1,
+    /* d */ 0,
+    /* e */ 1,
+    /* f */ 0,
+    /* g */ 1 | ccBit('e'),
+    /* h */ 0, /* i */ 0, /* j */ 0, /* k */ 0,
+    /* l */ 1 | ccBit('e'),
+    /* m */ ccBit('p'),
+    /* n */ ccBit('a') | ccBit('b') | ccBit('c') | ccBit('e') | ccBit('g') | ccBit('l') |
+            ccBit('o') | ccBit('p') | ccBit('s') | ccBit('z'),
+    /* o */ 1,
+    /* p */ 1 | ccBit('e') | ccBit('o'),
+    /* q */ 0, /* r */ 0,
+    /* s */ 1,
+    /* t */ 0, /* u */ 0, /* v */ 0, /* w */ 0, /* x */ 0, /* y */ 0,
+    /* z */ 1
+};
+
+/**
+ * @brief returns true if the length characters at start are a jump, loop
+ * or call mnemonic, in any case
+ * @details Also knows the AT&T size suffixes of jmp and call, as in callq.
+ */
+static bool isBranchMnemonic(const LineView &text, int start, int length)
+{
+    if (length < 2 || length > 6) return false;
+    char w[6];
+    for (int k = 0; k < length; ++k) {
+        const ushort c = text.at(start + k).unicode() | 0x20;
+        if (c < 'a' || c > 'z') return false;
+        w[k] = char(c);
+    }
+    const auto isSizeSuffix = [](char c) {
+        return c == 'q' || c == 'l' || c == 'w';
+    };
+
+    switch (w[0]) {
+    case 'j': {
+        const char *cc = w + 1;
+        const int n = length - 1;
+        if (n == 1) return conditionCodes[cc[0] - 'a'] & 1;
+        if (n == 2) return conditionCodes[cc[0] - 'a'] & ccBit(cc[1]);
+        if (n == 3) {
+            // jnae, jnbe, jnge, jnle, jcxz and jmpq
+            return (cc[0] == 'n' && cc[2] == 'e' && (conditionCodes[cc[1] - 'a'] & ccBit('e'))) ||
+                    std::memcmp(cc, "cxz", 3) == 0 ||
+                    (std::memcmp(cc, "mp", 2) == 0 && isSizeSuffix(cc[2]));
+        }
+        // jecxz and jrcxz
+        return n == 4 && (cc[0] == 'e' || cc[0] == 'r') && std::memcmp(cc + 1, "cxz", 3) == 0;
+    }
+    case 'l':
+        // loop, loope, loopz, loopne and loopnz
+        if (length < 4 || std::memcmp(w, "loop", 4) != 0) return false;
+        if (length == 4) return true;
+        if (length == 5) return w[4] == 'e' || w[4] == 'z';
+        return w[4] == 'n' && (w[5] == 'e' || w[5] == 'z');
+    case 'c':
+        return length >= 4 && length <= 5 && std::memcmp(w, "call", 4) == 0 &&
+                (length == 4 || isSizeSuffix(w[4]));
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Highlights labels and jump targets in one pass over the line
+ * @details Examples of labels:
+ * L1:
+ * LFB1:           # local func begin
+ *
+ * following e.gs are not a label
+ * mov %eax, Count::count(%rip)
+ * .string ": #%s"
+ *
+ * The operands of a jump, loop or call, like func() in "call func()", are
+ * its target.
+ */
+void QSourceTokenizer::asmHighlighter(const LineView &text)
+{
+    QSH_TRACE_SCOPE(AsmPass);
+    const int textLen = text.length();
+
+    int first = 0;
+    while (first < textLen && isSpace(text.at(first))) ++first;
+    int mnemonicEnd = first;
+    while (mnemonicEnd < textLen && isWordChar(text.at(mnemonicEnd))) ++mnemonicEnd;
+
+    //find the last colon and where the comment starts, a colon or comment
+    //character in a string doesn't count
+    const char comment = _compiledLanguage->comment;
+    const QChar *data = text.constData();
+    int colonPos = -1;
+    int i = first;
+    while ((i = findAsmDelimiter(data, i, textLen, comment)) < textLen) {
+        const QChar c = data[i];
+        if (comment && c == QLatin1Char(comment)) break;
+        if (c == QLatin1Char(':')) {
+            colonPos = i;
+        } else {
+            ++i;
+            while (i < textLen && data[i] != c) {
+                if (data[i] == QLatin1Char('\\')) ++i;
+                ++i;
+            }
+        }
+        ++i;
+    }
+    int codeEnd = qMin(i, textLen) - 1;
+    while (codeEnd >= first && isSpace(data[codeEnd])) --codeEnd;
+
+    //a label is followed by nothing but a comment
+    if (colonPos != -1 && colonPos == codeEnd)
+        formatRun(0, colonPos, underlined(QSourceHighliter::CodeBuiltIn));
+
+    //the operands of a jump, loop or call are its target
+    if (mnemonicEnd > first && isBranchMnemonic(text, first, mnemonicEnd - first)) {
+        int target = mnemonicEnd;
+        while (target < textLen && isSpace(text.at(target))) ++target;
+        if (target <= codeEnd)
+            formatRun(target, codeEnd + 1 - target, underlined(QSourceHighliter::CodeBuiltIn));
+    }
+}
+
+QSourceTokenizer::QSourceTokenizer()
+    : _language(QSourceHighliter::CodeC),
+      _compiledLanguage(compiledLanguage(QSourceHighliter::CodeC)),
+      _state(QSourceHighliter::CodeC),
+      _mode(CodeMode),
+      _depth(0),
+      _delimiter(0),
+      _guardLength(0),
+      _guardBudget(0),
+      _nextGuardCheck(INT_MAX),
+      _degraded(false)
+{
+}
+
+int QSourceTokenizer::tokenize(QStringView line, QSourceHighliter::Language language,
+                               int inState, QVector<TokenSpan> &spans)
+{
+    if (language != _language) {
+        QSH_TRACE_SCOPE(ResolveTables);
+        _language = language;
+        _compiledLanguage = compiledLanguage(language);
+    }
+
+    // states of other languages and -1 start in plain code
+    if (inState >= 0 && (inState & languageMask & ~1) == language) {
+        _state = inState & languageMask;
+        _mode = (inState >> modeShift) & modeMask;
+        _depth = (inState >> depthShift) & depthMask;
+        _delimiter = (inState >> delimiterShift) & delimiterMask;
+    } else {
+        _state = language;
+        _mode = CodeMode;
+        _depth = 0;
+        _delimiter = 0;
+    }
+
+    _degraded = false;
+    _nextGuardCheck = INT_MAX;
+    if (_guardBudget > 0 && line.size() > _guardLength) {
+        _guardTimer.start();
+        _nextGuardCheck = 0;
+    }
+
+    _lineCodes.fill(QSourceHighliter::CodeBlock, int(line.size()));
+    _swatches.resize(0);
+    highlightSyntax(LineView(line));
+    collectSpans(spans);
+    return _state | _mode << modeShift | qMin(_depth, depthMask) << depthShift |
+            _delimiter << delimiterShift;
+}
+
+void QSourceTokenizer::setLongLineGuard(int length, int msecs)
+{
+    _guardLength = length;
+    _guardBudget = msecs;
+}
+
+bool QSourceTokenizer::isDegraded() const
+{
+    return _degraded;
+}
+
+/**
+ * @brief degrades the line once the time of setLongLineGuard() is up
+ * @details Reading the clock costs more than lexing a few characters, so
+ * it is only read every guardStride characters.
+ */
+void QSourceTokenizer::checkGuard(int i)
+{
+    static const int guardStride = 4096;
+    if (_guardTimer.hasExpired(_guardBudget)) {
+        _degraded = true;
+        _nextGuardCheck = INT_MAX;
+    } else {
+        _nextGuardCheck = i + guardStride;
+    }
+}
+
+/**
+ * @brief gives count characters from start the code
+ * @details Later runs overwrite earlier ones, like setFormat().
+ */
+void QSourceTokenizer::formatRun(int start, int count, quint32 code)
+{
+    const int len = _lineCodes.size();
+    if (start < 0 || start >= len || count <= 0)
+        return;
+    const int end = qMin(start + count, len);
+    std::fill(_lineCodes.data() + start, _lineCodes.data() + end, code);
+}
+
+/**
+ * @brief merges equal codes into spans, leaving out plain CodeBlock text
+ */
+void QSourceTokenizer::collectSpans(QVector<TokenSpan> &spans) const
+{
+    // resize() keeps the capacity, so reused vectors don't allocate
+    spans.resize(0);
+
+    const int len = _lineCodes.size();
+    const quint32 *codes = _lineCodes.constData();
+    int start = 0;
+    while (start < len) {
+        const quint32 code = codes[start];
+        int end = start + 1;
+        while (end < len && codes[end] == code) ++end;
+        if (code != QSourceHighliter::CodeBlock) {
+            TokenSpan span;
+            span.start = start;
+            span.length = end - start;
+            span.token = static_cast<QSourceHighliter::Token>(code & 0xff);
+            span.flags = quint8(code >> 8);
+            span.background = span.flags & TokenSpan::ColorSwatch ?
+                        _swatches.at(int(code >> 16)) : 0;
+            spans.append(span);
+        }
+        start = end;
+    }
+}
+
+TokenizedLine tokenize(QStringView line, QSourceHighliter::Language language, int inState)
+{
+    QSourceTokenizer tokenizer;
+    TokenizedLine result;
+    result.state = tokenizer.tokenize(line, language, inState, result.spans);
+    return result;
+}
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef QSOURCETOKENIZER_H
+#define QSOURCETOKENIZER_H
+
+#include "qsourcehighliter.h"
+
+#include <QColor>
+#include <QElapsedTimer>
+#include <QStringView>
+#include <QVector>
+
+namespace QSourceHighlite {
+
+struct CompiledLanguage;
+class LineView;
+
+/**
+ * @brief A run of characters of a line that share one format
+ */
+struct TokenSpan {
+    enum Flag : quint8 {
+        // links in yaml, labels and jump targets in asm
+        Underline = 0x01,
+        // a css color, drawn on a background of that color
+        ColorSwatch = 0x02,
+        // a swatch whose color couldn't be parsed, drawn on the
+        // CodeBlock background instead of background
+        DefaultBackground = 0x04
+    };
+
+    int start;
+    int length;
+    QSourceHighliter::Token token;
+    quint8 flags;
+    // the swatch color, only set with ColorSwatch
+    QRgb background;
+};
+
+/**
+ * @brief The spans of a line and the state the line ends in
+ */
+struct TokenizedLine {
+    QVector<TokenSpan> spans;
+    int state;
+};
+
+/**
+ * @brief Splits lines of code into formatted spans
+ * @details This is the lexer behind QSourceHighliter, usable without a
+ * QTextDocument or QSyntaxHighlighter, e.g. on a worker thread.
+ *
+ * Lines are tokenized one at a time. The state a line ends in is passed to
+ * the next line, it tells whether the line ends inside a multi-line
+ * comment. Spans are sorted, don't overlap and leave out plain CodeBlock
+ * text.
+ *
+ * A tokenizer reuses its buffers from line to line, so tokenizing with the
+ * same tokenizer into the same span vector doesn't allocate once they have
+ * grown. It isn't thread-safe, use one tokenizer per thread.
+ */
+class QSourceTokenizer
+{
+public:
+    QSourceTokenizer();
+
+    /**
+     * @brief tokenizes a line
+     * @param line the text of the line, without the line break
+     * @param language the language of the line
+     * @param inState the state the previous line ended in, -1 for the
+     * first line
+     * @param spans set to the spans of the line
+     * @return the state the line ends in
+     * @details A state is never negative. Its low byte is the language,
+     * plus one inside a multi-line comment like the Comment values of
+     * QSourceHighliter::Language. The bits above it tell which other
+     * construct goes on over the line break, like a Python triple-quoted
+     * string or a YAML block scalar, with its nesting depth and delimiter.
+     * So a line's state only changes when that changes the next line.
+     * Nesting deeper than 254, a Lua long bracket of a higher level or a
+     * block scalar indented more than that leave the construct open until
+     * the end of the document.
+     */
+    int tokenize(QStringView line, QSourceHighliter::Language language,
+                 int inState, QVector<TokenSpan> &spans);
+
+    /**
+     * @brief bounds the time tokenize() spends on long lines
+     * @details A line of more than length characters is lexed in full
+     * until msecs have passed. After that only its strings, comments and
+     * numbers are found, which are all that decide the state it ends in,
+     * and isDegraded() is set. Off by default, 0 msecs turns it off.
+     * XML lines are always lexed in full, their tags decide the state.
+     */
+    void setLongLineGuard(int length, int msecs);
+
+    /**
+     * @brief whether the last line ran out of the time given by
+     * setLongLineGuard()
+     */
+    Q_REQUIRED_RESULT bool isDegraded() const;
+
+private:
+    // constructs other than /* */ comments that can go on over a line
+    // break
+    enum LexerMode {
+        CodeMode,
+        // Python, _delimiter is 1 for ''' and 0 for """
+        TripleQuoteMode,
+        // Lua, _depth is the number of '=', _delimiter is 1 for a comment
+        LongBracketMode,
+        // a string ending in a backslash, _delimiter is 1 for '
+        ContinuedStringMode,
+        // YAML, _depth is the indentation of the line that opened it
+        BlockScalarMode,
+        // XML, inside a tag, _delimiter is 1 in a "" value and 2 in a ''
+        // one. XML comments use the comment bit of _state.
+        XmlTagMode,
+        // XML, inside <![CDATA[ ]]>
+        XmlCDataMode
+    };
+
+    void highlightSyntax(const LineView &text);
+    Q_REQUIRED_RESULT int highlightContinuation(const LineView &text);
+    Q_REQUIRED_RESULT int formatConstruct(int start, int end, int textLen,
+                                          QSourceHighliter::Token token);
+    Q_REQUIRED_RESULT int commentEnd(const LineView &text, int from);
+    Q_REQUIRED_RESULT int highlightNumericLiterals(const LineView &text, int i);
+    Q_REQUIRED_RESULT int highlightStringLiterals(const QChar strType, const LineView &text, int i);
+    Q_REQUIRED_RESULT int highlightStringBody(const QChar strType, const LineView &text, int i);
+    void cssHighlighter(const LineView &text);
+    void ymlHighlighter(const LineView &text);
+    void xmlHighlighter(const LineView &text);
+    void makeHighlighter(const LineView &text);
+    void asmHighlighter(const LineView &text);
+
+    void checkGuard(int i);
+    void formatRun(int start, int count, quint32 code);
+    void collectSpans(QVector<TokenSpan> &spans) const;
+
+    QSourceHighliter::Language _language;
+    const CompiledLanguage *_compiledLanguage;
+    int _state;
+    // the rest of the state, see tokenize()
+    int _mode;
+    int _depth;
+    int _delimiter;
+    // the format of every character of the line, see formatRun()
+    QVector<quint32> _lineCodes;
+    QVector<QRgb> _swatches;
+    // see setLongLineGuard()
+    int _guardLength;
+    int _guardBudget;
+    QElapsedTimer _guardTimer;
+    // where checkGuard() is due next, INT_MAX on short lines
+    int _nextGuardCheck;
+    bool _degraded;
+};
+
+/**
+ * @brief tokenizes a line
+ * @details Convenience for QSourceTokenizer::tokenize() that allocates on
+ * every call.
+ */
+Q_REQUIRED_RESULT TokenizedLine tokenize(QStringView line, QSourceHighliter::Language language, int inState);
+
+}
+#endif // QSOURCETOKENIZER_H
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Tests of QSourceHighliter on a QTextDocument, run headless.
+ *
+ * formats() spells every block out as its state and the format ranges
+ * QSyntaxHighlighter left in its layout, so two highlightings of the same
+ * text can be compared block by block.
+ */
+
+#include "qsourcehighliter.h"
+#include "qsourcehighlitetracer.h"
+
+#include <QGuiApplication>
+#include <QStringList>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QTextLayout>
+#include <QThreadPool>
+#include <QtTest>
+
+using namespace QSourceHighlite;
+
+class tst_QSourceHighliter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void parallelMatchesSequential_data();
+    void parallelMatchesSequential();
+    void themeSwitchReusesSpans();
+};
+
+static QStringList formats(const QTextDocument &doc)
+{
+    QStringList result;
+    for (QTextBlock block = doc.firstBlock(); block.isValid(); block = block.next()) {
+        QString line = QString::number(block.userState()) + QLatin1Char(':');
+        for (const QTextLayout::FormatRange &range : block.layout()->formats()) {
+            line += QStringLiteral(" %1+%2 %3%4")
+                    .arg(range.start).arg(range.length)
+                    .arg(range.format.foreground().color().name())
+                    .arg(range.format.fontUnderline() ? QStringLiteral(" u") : QString());
+        }
+        result << line;
+    }
+    return result;
+}
+
+void tst_QSourceHighliter::initTestCase()
+{
+    // rehighlightParallel() lexes on one thread only if the pool has one
+    if (QThreadPool::globalInstance()->maxThreadCount() < 2)
+        QThreadPool::globalInstance()->setMaxThreadCount(2);
+}
+
+void tst_QSourceHighliter::parallelMatchesSequential_data()
+{
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QString>("open");
+    QTest::addColumn<QString>("close");
+
+    QTest::newRow("cpp") << int(QSourceHighliter::CodeCpp)
+                         << QStringLiteral("int a = 1; /* a comment")
+                         << QStringLiteral("   that ends here */ int b = 0x2;");
+    QTest::newRow("rust") << int(QSourceHighliter::CodeRust)
+                          << QStringLiteral("let a = 1; /* a /* nested")
+                          << QStringLiteral("   comment */ that ends */ let b = 0x2;");
+}
+
+void tst_QSourceHighliter::parallelMatchesSequential()
+{
+    QFETCH(int, language);
+    QFETCH(QString, open);
+    QFETCH(QString, close);
+
+    // 6000 lines, which rehighlightParallel() lexes in chunks of 1000,
+    // with a comment from 5 lines before every chunk boundary to 5 lines
+    // after it, so every chunk but the first starts inside one
+    QStringList lines;
+    for (int i = 0; i < 6000; ++i) {
+        if (i % 1000 == 995)
+            lines << open;
+        else if (i % 1000 == 5 && i > 1000)
+            lines << close;
+        else
+            lines << QStringLiteral("    x = call(y, \"s\", %1); // line").arg(i);
+    }
+    const QString text = lines.join(QLatin1Char('\n'));
+
+    QTextDocument sequentialDoc(text);
+    QSourceHighliter sequential(&sequentialDoc);
+    sequential.setCurrentLanguage(QSourceHighliter::Language(language));
+    sequential.rehighlight();
+
+    QTextDocument parallelDoc(text);
+    QSourceHighliter parallel(&parallelDoc);
+    parallel.setCurrentLanguage(QSourceHighliter::Language(language));
+    parallel.rehighlightParallel();
+
+    QCOMPARE(formats(parallelDoc), formats(sequentialDoc));
+}
+
+void tst_QSourceHighliter::themeSwitchReusesSpans()
+{
+    QStringList lines;
+    for (int i = 0; i < 100; ++i)
+        lines << QStringLiteral("int x%1 = call(\"s\", %1); /* a").arg(i)
+              << QStringLiteral("   comment */ return 0x2;");
+    const QString text = lines.join(QLatin1Char('\n'));
+
+    QTextDocument doc(text);
+    QSourceHighliter highlighter(&doc, QSourceHighliter::Monokai);
+    highlighter.setCurrentLanguage(QSourceHighliter::CodeCpp);
+    highlighter.rehighlight();
+
+    QSourceHighliteTracer::reset();
+    QSourceHighliteTracer::setEnabled(true);
+    highlighter.setTheme(QSourceHighliter::LightTheme);
+    QSourceHighliteTracer::setEnabled(false);
+    QCOMPARE(QSourceHighliteTracer::total(QSourceHighliteTracer::BlocksLexed), quint64(0));
+    QCOMPARE(QSourceHighliteTracer::total(QSourceHighliteTracer::CacheHits),
+             quint64(doc.blockCount()));
+
+    // the reused spans get the new theme's formats
+    QTextDocument lightDoc(text);
+    QSourceHighliter light(&lightDoc, QSourceHighliter::LightTheme);
+    light.setCurrentLanguage(QSourceHighliter::CodeCpp);
+    light.rehighlight();
+    QCOMPARE(formats(doc), formats(lightDoc));
+}
+
+int main(int argc, char *argv[])
+{
+    // headless like the benchmark
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    tst_QSourceHighliter test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_qsourcehighliter.moc"
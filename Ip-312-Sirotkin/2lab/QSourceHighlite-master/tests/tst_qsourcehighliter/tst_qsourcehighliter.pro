@@ -0,0 +1,16 @@
+QT       += core gui testlib
+CONFIG   += console c++11 testcase
+# the tracer's counters show whether blocks were lexed
+CONFIG   += qsourcehighlite_trace
+CONFIG   -= app_bundle
+
+TARGET = tst_qsourcehighliter
+
+include(../../QSourceHighlite.pri)
+
+INCLUDEPATH += $$PWD/../..
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    tst_qsourcehighliter.cpp
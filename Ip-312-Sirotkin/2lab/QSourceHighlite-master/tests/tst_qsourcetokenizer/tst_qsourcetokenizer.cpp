@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Regression tests for QSourceTokenizer, run headless.
+ *
+ * lex() tokenizes lines one after another, passing the state along like
+ * QSourceHighliter does, and spells every line out as one letter per
+ * character, so the expected tokens are written right under the source.
+ * Each line gets a tokenizer of its own, so nothing but the state carries
+ * over to the next line:
+ *
+ *   .  CodeBlock       k  CodeKeyWord     s  CodeString
+ *   c  CodeComment     t  CodeType        o  CodeOther
+ *   n  CodeNumLiteral  b  CodeBuiltIn     #  a color swatch
+ *
+ * Underlined spans are in upper case.
+ */
+
+#include "qsourcetokenizer.h"
+
+#include <QStringList>
+#include <QtTest>
+
+using namespace QSourceHighlite;
+
+class tst_QSourceTokenizer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void escapedBackslashEndsString();
+    void backslashContinuesString();
+    void unicodeEscapes();
+    void xmlTagOverLines();
+    void xmlCommentOverLines();
+    void xmlCData();
+    void cssColorsOnOneLine();
+    void cssColorsPastSwatchLimit();
+    void yamlAnchorsAndAliases();
+    void yamlTags();
+    void yamlQuotedKeys();
+    void asmLabels();
+    void asmJumpTargets();
+    void luaLongBrackets();
+    void rustNestedComments();
+    void pythonTripleQuotes();
+    void yamlBlockScalar();
+    void nestingTooDeepToStore();
+    void numberLiterals();
+    void sqlAndAsmKeywordsInAnyCase();
+    void cmakeWordsAsListed();
+};
+
+static QStringList lex(const QStringList &lines, QSourceHighliter::Language language,
+                       QVector<int> *states = nullptr)
+{
+    static const char letters[] = ".ksctonb";
+
+    QVector<TokenSpan> spans;
+    QStringList result;
+    int state = -1;
+    for (const QString &line : lines) {
+        QSourceTokenizer tokenizer;
+        state = tokenizer.tokenize(QStringView(line), language, state, spans);
+        if (states) states->append(state);
+        QString out(line.size(), QLatin1Char('.'));
+        for (const TokenSpan &span : spans) {
+            QChar c = QLatin1Char(letters[span.token]);
+            if (span.flags & TokenSpan::ColorSwatch) c = QLatin1Char('#');
+            if (span.flags & TokenSpan::Underline) c = c.toUpper();
+            for (int i = span.start; i < span.start + span.length; ++i)
+                out[i] = c;
+        }
+        result << out;
+    }
+    return result;
+}
+
+// the colors of the swatches of a line, 0 for those that couldn't be parsed
+static QVector<QRgb> swatches(const QString &line)
+{
+    QSourceTokenizer tokenizer;
+    QVector<TokenSpan> spans;
+    QVector<QRgb> colors;
+    tokenizer.tokenize(QStringView(line), QSourceHighliter::CodeCSS, -1, spans);
+    for (const TokenSpan &span : spans) {
+        if (span.flags & TokenSpan::ColorSwatch)
+            colors.append(span.flags & TokenSpan::DefaultBackground ? 0 : span.background);
+    }
+    return colors;
+}
+
+void tst_QSourceTokenizer::escapedBackslashEndsString()
+{
+    QCOMPARE(lex({QStringLiteral("s = \"\\\\\"; int x;")}, QSourceHighliter::CodeCpp),
+             QStringList({QStringLiteral("....snns..ttt...")}));
+    QCOMPARE(lex({QStringLiteral("c = '\\\\' + 'a'")}, QSourceHighliter::CodePython),
+             QStringList({QStringLiteral("....snns...sss")}));
+}
+
+void tst_QSourceTokenizer::backslashContinuesString()
+{
+    QCOMPARE(lex({QStringLiteral("s = \"ab\\"),
+                  QStringLiteral("cd\"; int x;")}, QSourceHighliter::CodeCpp),
+             QStringList({QStringLiteral("....ssss"),
+                          QStringLiteral("sss..ttt...")}));
+    QCOMPARE(lex({QStringLiteral("s = 'ab\\"),
+                  QStringLiteral("cd'; return x")}, QSourceHighliter::CodeJs),
+             QStringList({QStringLiteral("....ssss"),
+                          QStringLiteral("sss..kkkkkk..")}));
+    // an escaped backslash at the end doesn't continue the string
+    QCOMPARE(lex({QStringLiteral("s = \"ab\\\\"),
+                  QStringLiteral("int x;")}, QSourceHighliter::CodeCpp),
+             QStringList({QStringLiteral("....sssnn"),
+                          QStringLiteral("ttt...")}));
+    // nor does a backslash in a language without continued strings
+    QCOMPARE(lex({QStringLiteral("s := \"ab\\"),
+                  QStringLiteral("x := 1")}, QSourceHighliter::CodeGo),
+             QStringList({QStringLiteral(".....ssss"),
+                          QStringLiteral(".....n")}));
+}
+
+void tst_QSourceTokenizer::unicodeEscapes()
+{
+    QCOMPARE(lex({QStringLiteral("\"\\u00e9\\U0001F600\\x41\\101\\n\"")}, QSourceHighliter::CodeCpp),
+             QStringList({QStringLiteral("snnnnnnnnnnnnnnnnnnnnnnnnnns")}));
+    QCOMPARE(lex({QStringLiteral("\"\\u{1F600}\\u{}\\u12\"")}, QSourceHighliter::CodeRust),
+             QStringList({QStringLiteral("snnnnnnnnnsssssssss")}));
+}
+
+void tst_QSourceTokenizer::xmlTagOverLines()
+{
+    QCOMPARE(lex({QStringLiteral("<a href=\"x\""),
+                  QStringLiteral("   title='t'>text</a>")}, QSourceHighliter::CodeXML),
+             QStringList({QStringLiteral(".k.bbbb.sss"),
+                          QStringLiteral("...bbbbb.sss.......k.")}));
+    // a value can go on over a line break too
+    QCOMPARE(lex({QStringLiteral("<p class=\"a"),
+                  QStringLiteral("b\" id='1'>x")}, QSourceHighliter::CodeXML),
+             QStringList({QStringLiteral(".k.bbbbb.ss"),
+                          QStringLiteral("ss.bb.sss..")}));
+}
+
+void tst_QSourceTokenizer::xmlCommentOverLines()
+{
+    QCOMPARE(lex({QStringLiteral("<a><!-- one <b>"),
+                  QStringLiteral("two -- > still"),
+                  QStringLiteral("--> <c/>")}, QSourceHighliter::CodeXML),
+             QStringList({QStringLiteral(".k.cccccccccccc"),
+                          QStringLiteral("cccccccccccccc"),
+                          QStringLiteral("ccc..k..")}));
+}
+
+void tst_QSourceTokenizer::xmlCData()
+{
+    QCOMPARE(lex({QStringLiteral("<x><![CDATA[a <b> \""),
+                  QStringLiteral("]]> <y>")}, QSourceHighliter::CodeXML),
+             QStringList({QStringLiteral(".k.ssssssssssssssss"),
+                          QStringLiteral("sss..k.")}));
+}
+
+void tst_QSourceTokenizer::cssColorsOnOneLine()
+{
+    const QString line = QStringLiteral("a { color: #f00; background-color: rgb(0, 0, 255); "
+                                        "border-color: rgb(1, 2); outline-color: #f00 }");
+    QCOMPARE(lex({line}, QSourceHighliter::CodeCSS),
+             QStringList({QStringLiteral("....ttttt..####..tttttttttt.ttttt..##############..tttttt.ttttt..#########..ttttttt.ttttt..####..")}));
+    QCOMPARE(swatches(line), QVector<QRgb>({qRgb(255, 0, 0), qRgb(0, 0, 255), 0, qRgb(255, 0, 0)}));
+}
+
+void tst_QSourceTokenizer::cssColorsPastSwatchLimit()
+{
+    // a swatch index has 16 bits
+    QString line;
+    for (int i = 0; i < 0x10000 + 2; ++i)
+        line += QStringLiteral("a{color:#%1}").arg(i, 6, 16, QLatin1Char('0'));
+    const QVector<QRgb> colors = swatches(line);
+    QCOMPARE(colors.size(), 0x10000);
+    QCOMPARE(colors.last(), qRgb(0x00, 0xff, 0xff));
+    // the ones after the last swatch are numbers
+    const QString tokens = lex({line}, QSourceHighliter::CodeCSS).first();
+    QCOMPARE(tokens.right(16), QStringLiteral("..ttttt.nnnnnnn."));
+}
+
+void tst_QSourceTokenizer::yamlAnchorsAndAliases()
+{
+    // a lone & or * is plain text
+    QCOMPARE(lex({QStringLiteral("base: &base {a: 1, b: *ref}"),
+                  QStringLiteral("<<: *base"),
+                  QStringLiteral("- a & b * c")}, QSourceHighliter::CodeYAML),
+             QStringList({QStringLiteral("kkkk..bbbbb..k..n..k..bbbb."),
+                          QStringLiteral("kk..bbbbb"),
+                          QStringLiteral("...........")}));
+}
+
+void tst_QSourceTokenizer::yamlTags()
+{
+    QCOMPARE(lex({QStringLiteral("date: !!timestamp 2001-12-14"),
+                  QStringLiteral("list: !local [a, !!str b]"),
+                  QStringLiteral("text: !!str | # tag and block scalar")}, QSourceHighliter::CodeYAML),
+             QStringList({QStringLiteral("kkkk..ttttttttttt.nnnn.nn.nn"),
+                          QStringLiteral("kkkk..tttttt.....ttttt..."),
+                          QStringLiteral("kkkk..ttttt.o.cccccccccccccccccccccc")}));
+}
+
+void tst_QSourceTokenizer::yamlQuotedKeys()
+{
+    // a colon in a quoted scalar, a path or a link doesn't make a key
+    QCOMPARE(lex({QStringLiteral("\"a: b\": 'c: d' # e: f"),
+                  QStringLiteral("{\"x\": 1, y: \"\\\"z: \"}"),
+                  QStringLiteral("path: C:\\dir"),
+                  QStringLiteral("url: http://a.org/#x")}, QSourceHighliter::CodeYAML),
+             QStringList({QStringLiteral("ssssss..ssssss.cccccc"),
+                          QStringLiteral(".sss..n..k..snnssss."),
+                          QStringLiteral("kkkk........"),
+                          QStringLiteral("kkk..SSSSSSSSSSSSSSS")}));
+}
+
+void tst_QSourceTokenizer::asmLabels()
+{
+    // only a colon with nothing but a comment after it ends a label
+    QCOMPARE(lex({QStringLiteral("LFB1:    # local func begin"),
+                  QStringLiteral("_ZN5Count5countEv:"),
+                  QStringLiteral("    movl %eax, Count::count(%rip)"),
+                  QStringLiteral("    .string \": #%s\""),
+                  QStringLiteral("    lea rax, [rip + a::b]   # c:")}, QSourceHighliter::CodeAsm),
+             QStringList({QStringLiteral("BBBB.....cccccccccccccccccc"),
+                          QStringLiteral("BBBBBBBBBBBBBBBBB."),
+                          QStringLiteral("....kkkk..ttt................ttt."),
+                          QStringLiteral("............sssssss"),
+                          QStringLiteral("....kkk.ttt...ttt...........cccc")}));
+}
+
+void tst_QSourceTokenizer::asmJumpTargets()
+{
+    // the operands of a jump, loop or call up to the comment
+    QCOMPARE(lex({QStringLiteral("    jmp .L2"),
+                  QStringLiteral("    jne     .L3    # back"),
+                  QStringLiteral("    callq _ZN5Count5countEv@PLT"),
+                  QStringLiteral("    loopne top"),
+                  QStringLiteral("    jrcxz done"),
+                  QStringLiteral("    jumps x"),
+                  QStringLiteral("    jecxzq x")}, QSourceHighliter::CodeAsm),
+             QStringList({QStringLiteral("....kkk.BBB"),
+                          QStringLiteral("....kkk.....BBB....cccccc"),
+                          QStringLiteral("..........BBBBBBBBBBBBBBBBBBBBB"),
+                          QStringLiteral("....kkkkkk.BBB"),
+                          QStringLiteral("....kkkkk.BBBB"),
+                          QStringLiteral("..........."),
+                          QStringLiteral("............")}));
+}
+
+void tst_QSourceTokenizer::luaLongBrackets()
+{
+    QVector<int> states;
+    QCOMPARE(lex({QStringLiteral("s = [==[ a ]] b"),
+                  QStringLiteral("]=] c ]==] x = 1"),
+                  QStringLiteral("--[[ c"),
+                  QStringLiteral("]==] ]] y")}, QSourceHighliter::CodeLua, &states),
+             QStringList({QStringLiteral("....sssssssssss"),
+                          QStringLiteral("ssssssssss.....n"),
+                          QStringLiteral("cccccc"),
+                          QStringLiteral("ccccccc..")}));
+    QVERIFY(states.at(0) != QSourceHighliter::CodeLua);
+    QCOMPARE(states.at(1), int(QSourceHighliter::CodeLua));
+    QVERIFY(states.at(2) != QSourceHighliter::CodeLua);
+    QVERIFY(states.at(2) != states.at(0));
+    QCOMPARE(states.at(3), int(QSourceHighliter::CodeLua));
+}
+
+void tst_QSourceTokenizer::rustNestedComments()
+{
+    QVector<int> states;
+    QCOMPARE(lex({QStringLiteral("/* a /* b */ c"),
+                  QStringLiteral("/* d */ e"),
+                  QStringLiteral("*/ fn x")}, QSourceHighliter::CodeRust, &states),
+             QStringList({QStringLiteral("cccccccccccccc"),
+                          QStringLiteral("ccccccccc"),
+                          QStringLiteral("cc.kk..")}));
+    QVERIFY(states.at(0) % 2 != 0);
+    QCOMPARE(states.at(1), states.at(0));
+    QCOMPARE(states.at(2), int(QSourceHighliter::CodeRust));
+}
+
+void tst_QSourceTokenizer::pythonTripleQuotes()
+{
+    QVector<int> states;
+    QCOMPARE(lex({QStringLiteral("s = \"\"\"a # b"),
+                  QStringLiteral("c ''' def"),
+                  QStringLiteral("d\"\"\" + 'e' # f")}, QSourceHighliter::CodePython, &states),
+             QStringList({QStringLiteral("....ssssssss"),
+                          QStringLiteral("sssssssss"),
+                          QStringLiteral("ssss...sss.ccc")}));
+    QVERIFY(states.at(0) != QSourceHighliter::CodePython);
+    QCOMPARE(states.at(1), states.at(0));
+    QCOMPARE(states.at(2), int(QSourceHighliter::CodePython));
+}
+
+void tst_QSourceTokenizer::yamlBlockScalar()
+{
+    QVector<int> states;
+    QCOMPARE(lex({QStringLiteral("  key: |"),
+                  QStringLiteral("    text: no key"),
+                  QStringLiteral(""),
+                  QStringLiteral("      more"),
+                  QStringLiteral("  next: 1")}, QSourceHighliter::CodeYAML, &states),
+             QStringList({QStringLiteral("..kkk..o"),
+                          QStringLiteral("ssssssssssssssss"),
+                          QStringLiteral(""),
+                          QStringLiteral("ssssssssss"),
+                          QStringLiteral("..kkkk..n")}));
+    QVERIFY(states.at(0) != QSourceHighliter::CodeYAML);
+    QCOMPARE(states.at(3), states.at(0));
+    QCOMPARE(states.at(4), int(QSourceHighliter::CodeYAML));
+
+    // a comment after the indicator
+    QCOMPARE(lex({QStringLiteral("key: | # note"),
+                  QStringLiteral("  a: b"),
+                  QStringLiteral("- >- # x"),
+                  QStringLiteral("  c: d # e"),
+                  QStringLiteral("f: g #|")}, QSourceHighliter::CodeYAML, &states),
+             QStringList({QStringLiteral("kkk..o.cccccc"),
+                          QStringLiteral("ssssss"),
+                          QStringLiteral("..oo.ccc"),
+                          QStringLiteral("ssssssssss"),
+                          QStringLiteral("k....cc")}));
+    QCOMPARE(states.last(), int(QSourceHighliter::CodeYAML));
+}
+
+void tst_QSourceTokenizer::nestingTooDeepToStore()
+{
+    // the state has 8 bits for the depth, deeper comments and strings stay
+    // open instead of ending at a wrong depth
+    const int deep = 300;
+    QCOMPARE(lex({QStringLiteral("/* ").repeated(deep),
+                  QStringLiteral("*/ ").repeated(deep),
+                  QStringLiteral("fn x")}, QSourceHighliter::CodeRust).last(),
+             QStringLiteral("cccc"));
+    // nor does a long bracket end at the level it would be cut to
+    QCOMPARE(lex({QStringLiteral("s = [") + QStringLiteral("=").repeated(deep) + QStringLiteral("["),
+                  QStringLiteral("]") + QStringLiteral("=").repeated(0xff) + QStringLiteral("]"),
+                  QStringLiteral("x = 1")}, QSourceHighliter::CodeLua).last(),
+             QStringLiteral("sssss"));
+    // nesting that ends on its own line is never stored
+    QCOMPARE(lex({QStringLiteral("/* ").repeated(deep) + QStringLiteral("*/ ").repeated(deep),
+                  QStringLiteral("fn x")}, QSourceHighliter::CodeRust).last(),
+             QStringLiteral("kk.."));
+}
+
+void tst_QSourceTokenizer::numberLiterals()
+{
+    // a trailing separator or a digit of another base spoils the number
+    QCOMPARE(lex({QStringLiteral("x = 0x1.8p3 + 0X1P-2f + 0b1010 + 017 + 1'000'000 + 10ul;"),
+                  QStringLiteral("y = 0x1.8 + 0b12 + 1'000'")}, QSourceHighliter::CodeCpp),
+             QStringList({QStringLiteral("....nnnnnnn...nnnnnnn...nnnnnn...nnn...nnnnnnnnn...nnnn."),
+                          QStringLiteral("....nnnnn...............s")}));
+    // ' starts a character literal outside of C++
+    QCOMPARE(lex({QStringLiteral("x = 1'000;"),
+                  QStringLiteral("c = 1000L + '1';")}, QSourceHighliter::CodeC),
+             QStringList({QStringLiteral(".....sssss"),
+                          QStringLiteral("....nnnnn...sss.")}));
+    QCOMPARE(lex({QStringLiteral("x = 1_000_000L + 0x1.8p3 + 1'0';")}, QSourceHighliter::CodeJava),
+             QStringList({QStringLiteral("....nnnnnnnnnn...nnnnnnn....sss.")}));
+    QCOMPARE(lex({QStringLiteral("x = 10n + 0b11 + 0o17 + 1_000 + 1.5e-3;")}, QSourceHighliter::CodeJs),
+             QStringList({QStringLiteral("....nnn...nnnn...nnnn...nnnnn...nnnnnn.")}));
+    QCOMPARE(lex({QStringLiteral("let x = 1.0f32 + 0o17 + 1_000u64 + 0xffi8 + 2.5abc;")}, QSourceHighliter::CodeRust),
+             QStringList({QStringLiteral("kkk.....nnnnnn...nnnn...nnnnnnnn...nnnnnn..........")}));
+    // suffixes are those of the language
+    QCOMPARE(lex({QStringLiteral("x = 0o17 + 1_000 + 2j + 10ul")}, QSourceHighliter::CodePython),
+             QStringList({QStringLiteral("....nnnn...nnnnn...nn.......")}));
+}
+
+void tst_QSourceTokenizer::sqlAndAsmKeywordsInAnyCase()
+{
+    QCOMPARE(lex({QStringLiteral("SELECT a FROM t;"),
+                  QStringLiteral("Select a From t;"),
+                  QStringLiteral("select a from t;")}, QSourceHighliter::CodeSQL),
+             QStringList({QStringLiteral("kkkkkk...kkkk..."),
+                          QStringLiteral("kkkkkk...kkkk..."),
+                          QStringLiteral("kkkkkk...kkkk...")}));
+    QCOMPARE(lex({QStringLiteral("    MOV EAX, 1"),
+                  QStringLiteral("    Mov Eax, 1"),
+                  QStringLiteral("    mov eax, 1")}, QSourceHighliter::CodeAsm),
+             QStringList({QStringLiteral("....kkk.ttt..n"),
+                          QStringLiteral("....kkk.ttt..n"),
+                          QStringLiteral("....kkk.ttt..n")}));
+}
+
+void tst_QSourceTokenizer::cmakeWordsAsListed()
+{
+    // commands match in any case, other words only as listed. The word as
+    // written wins, so INCLUDE_DIRECTORIES is the property, not the command.
+    QCOMPARE(lex({QStringLiteral("Include_Directories(a)"),
+                  QStringLiteral("INCLUDE_DIRECTORIES(a)"),
+                  QStringLiteral("set(A ON On on)")}, QSourceHighliter::CodeCMake),
+             QStringList({QStringLiteral("kkkkkkkkkkkkkkkkkkk..."),
+                          QStringLiteral("bbbbbbbbbbbbbbbbbbb..."),
+                          QStringLiteral("kkk...nn....nn.")}));
+}
+
+QTEST_GUILESS_MAIN(tst_QSourceTokenizer)
+
+#include "tst_qsourcetokenizer.moc"
@@ -0,0 +1,14 @@
+QT       += core gui testlib
+CONFIG   += console c++11 testcase
+CONFIG   -= app_bundle
+
+TARGET = tst_qsourcetokenizer
+
+include(../../QSourceHighlite.pri)
+
+INCLUDEPATH += $$PWD/../..
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    tst_qsourcetokenizer.cpp
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "textscanner.h"
+
+#include <QChar>
+#include <QtAlgorithms>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define QSOURCEHIGHLITE_SSE2
+#endif
+
+namespace QSourceHighlite {
+
+static inline bool isTokenStart(ushort c, ushort comment)
+{
+    if (c >= 0x80)
+        return true;
+    const ushort lower = c | 0x20;
+    return (lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') ||
+            c == '"' || c == '\'' || c == '/' || c == '-' || c == comment;
+}
+
+#if defined(__AVX2__)
+static inline quint32 tokenStartMask(__m256i c, __m256i comment)
+{
+    const __m256i ascii = _mm256_cmpeq_epi16(
+                _mm256_and_si256(c, _mm256_set1_epi16(short(0xff80))),
+                _mm256_setzero_si256());
+    // the comparisons below are signed, which is fine for ASCII lanes
+    const __m256i lower = _mm256_or_si256(c, _mm256_set1_epi16(0x20));
+    const __m256i letter = _mm256_and_si256(
+                _mm256_cmpgt_epi16(lower, _mm256_set1_epi16('a' - 1)),
+                _mm256_cmpgt_epi16(_mm256_set1_epi16('z' + 1), lower));
+    const __m256i digit = _mm256_and_si256(
+                _mm256_cmpgt_epi16(c, _mm256_set1_epi16('0' - 1)),
+                _mm256_cmpgt_epi16(_mm256_set1_epi16('9' + 1), c));
+    __m256i hit = _mm256_or_si256(letter, digit);
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(c, _mm256_set1_epi16('"')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(c, _mm256_set1_epi16('\'')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(c, _mm256_set1_epi16('/')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(c, _mm256_set1_epi16('-')));
+    hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(c, comment));
+    hit = _mm256_or_si256(hit, _mm256_andnot_si256(ascii, _mm256_set1_epi16(-1)));
+    return quint32(_mm256_movemask_epi8(hit));
+}
+#elif defined(QSOURCEHIGHLITE_SSE2)
+static inline quint32 tokenStartMask(__m128i c, __m128i comment)
+{
+    const __m128i ascii = _mm_cmpeq_epi16(
+                _mm_and_si128(c, _mm_set1_epi16(short(0xff80))),
+                _mm_setzero_si128());
+    // the comparisons below are signed, which is fine for ASCII lanes
+    const __m128i lower = _mm_or_si128(c, _mm_set1_epi16(0x20));
+    const __m128i letter = _mm_and_si128(
+                _mm_cmpgt_epi16(lower, _mm_set1_epi16('a' - 1)),
+                _mm_cmplt_epi16(lower, _mm_set1_epi16('z' + 1)));
+    const __m128i digit = _mm_and_si128(
+                _mm_cmpgt_epi16(c, _mm_set1_epi16('0' - 1)),
+                _mm_cmplt_epi16(c, _mm_set1_epi16('9' + 1)));
+    __m128i hit = _mm_or_si128(letter, digit);
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(c, _mm_set1_epi16('"')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(c, _mm_set1_epi16('\'')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(c, _mm_set1_epi16('/')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(c, _mm_set1_epi16('-')));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(c, comment));
+    hit = _mm_or_si128(hit, _mm_andnot_si128(ascii, _mm_set1_epi16(-1)));
+    return quint32(_mm_movemask_epi8(hit));
+}
+#endif
+
+int findTokenStart(const QChar *text, int from, int length, char comment)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(text);
+    // without a comment character compare against '/' a second time
+    // rather than stopping at every NUL
+    const ushort commentChar = comment ? ushort(uchar(comment)) : ushort('/');
+    int i = from;
+
+#if defined(__AVX2__)
+    const __m256i commentVec = _mm256_set1_epi16(short(commentChar));
+    for (; i + 16 <= length; i += 16) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        if (const quint32 mask = tokenStartMask(c, commentVec))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#elif defined(QSOURCEHIGHLITE_SSE2)
+    const __m128i commentVec = _mm_set1_epi16(short(commentChar));
+    for (; i + 8 <= length; i += 8) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        if (const quint32 mask = tokenStartMask(c, commentVec))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#endif
+
+    for (; i < length; ++i) {
+        if (isTokenStart(s[i], commentChar))
+            return i;
+    }
+    return length;
+}
+
+int findQuoteOrEscape(const QChar *text, int from, int length, QChar quote)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(text);
+    const ushort q = quote.unicode();
+    int i = from;
+
+#if defined(__AVX2__)
+    const __m256i quoteVec = _mm256_set1_epi16(short(q));
+    const __m256i backslash = _mm256_set1_epi16('\\');
+    for (; i + 16 <= length; i += 16) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        const __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi16(c, quoteVec),
+                                            _mm256_cmpeq_epi16(c, backslash));
+        if (const quint32 mask = quint32(_mm256_movemask_epi8(hit)))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#elif defined(QSOURCEHIGHLITE_SSE2)
+    const __m128i quoteVec = _mm_set1_epi16(short(q));
+    const __m128i backslash = _mm_set1_epi16('\\');
+    for (; i + 8 <= length; i += 8) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        const __m128i hit = _mm_or_si128(_mm_cmpeq_epi16(c, quoteVec),
+                                         _mm_cmpeq_epi16(c, backslash));
+        if (const quint32 mask = quint32(_mm_movemask_epi8(hit)))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#endif
+
+    for (; i < length; ++i) {
+        if (s[i] == q || s[i] == '\\')
+            return i;
+    }
+    return length;
+}
+
+
+int findAsmDelimiter(const QChar *text, int from, int length, char comment)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(text);
+    // without a comment character compare against ':' a second time
+    const ushort commentChar = comment ? ushort(uchar(comment)) : ushort(':');
+    int i = from;
+
+#if defined(__AVX2__)
+    const __m256i colon = _mm256_set1_epi16(':');
+    const __m256i quote = _mm256_set1_epi16('"');
+    const __m256i apostrophe = _mm256_set1_epi16('\'');
+    const __m256i commentVec = _mm256_set1_epi16(short(commentChar));
+    for (; i + 16 <= length; i += 16) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        const __m256i hit = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi16(c, colon), _mm256_cmpeq_epi16(c, quote)),
+                    _mm256_or_si256(_mm256_cmpeq_epi16(c, apostrophe),
+                                    _mm256_cmpeq_epi16(c, commentVec)));
+        if (const quint32 mask = quint32(_mm256_movemask_epi8(hit)))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#elif defined(QSOURCEHIGHLITE_SSE2)
+    const __m128i colon = _mm_set1_epi16(':');
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i apostrophe = _mm_set1_epi16('\'');
+    const __m128i commentVec = _mm_set1_epi16(short(commentChar));
+    for (; i + 8 <= length; i += 8) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        const __m128i hit = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi16(c, colon), _mm_cmpeq_epi16(c, quote)),
+                    _mm_or_si128(_mm_cmpeq_epi16(c, apostrophe), _mm_cmpeq_epi16(c, commentVec)));
+        if (const quint32 mask = quint32(_mm_movemask_epi8(hit)))
+            return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+#endif
+
+    for (; i < length; ++i) {
+        const ushort c = s[i];
+        if (c == ':' || c == '"' || c == '\'' || c == commentChar)
+            return i;
+    }
+    return length;
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef TEXTSCANNER_H
+#define TEXTSCANNER_H
+
+#include <QtGlobal>
+
+QT_BEGIN_NAMESPACE
+class QChar;
+QT_END_NAMESPACE
+
+namespace QSourceHighlite {
+
+/**
+ * @brief returns the index of the first character at or after from that
+ * can start a token, or length if there is none
+ * @details A token can start at an ASCII letter or digit, a quote, '/',
+ * '-', the line comment character of the language or any non-ASCII
+ * character. Whitespace and other punctuation are skipped 8 or 16
+ * characters at a time where SSE2 or AVX2 is available.
+ * @param comment the line comment character, or another character that
+ * starts a token in the language, 0 if there is none
+ */
+Q_REQUIRED_RESULT int findTokenStart(const QChar *text, int from, int length, char comment);
+
+/**
+ * @brief returns the index of the first quote or backslash at or after
+ * from, or length if there is none
+ * @details Used to skip over the plain text of string literals, 8 or 16
+ * characters at a time where SSE2 or AVX2 is available.
+ */
+Q_REQUIRED_RESULT int findQuoteOrEscape(const QChar *text, int from, int length, QChar quote);
+
+/**
+ * @brief returns the index of the first ':', quote or comment character at
+ * or after from, or length if there is none
+ * @details Splits an assembly line into its label, strings and comment,
+ * 8 or 16 characters at a time where SSE2 or AVX2 is available.
+ * @param comment the line comment character, 0 if there is none
+ */
+Q_REQUIRED_RESULT int findAsmDelimiter(const QChar *text, int from, int length, char comment);
+
+}
+#endif // TEXTSCANNER_H
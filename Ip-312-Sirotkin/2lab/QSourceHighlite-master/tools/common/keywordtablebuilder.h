@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * The parts of the table generators shared by tools/languagetablesgen and
+ * tools/grammarcompiler: reading the word lists of languagedata.cpp and
+ * building the perfect hash tables (power-of-two table) that KeywordTable
+ * looks words up in. Both tools are single source files, so everything is inline.
+ */
+
+#ifndef KEYWORDTABLEBUILDER_H
+#define KEYWORDTABLEBUILDER_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace KeywordTableBuilder {
+
+const char *const categories[] = { "types", "keywords", "builtin", "literals", "other" };
+const int categoryCount = 5;
+
+// the order highlightSyntax() checked the lists in, first match wins
+const int categoryPriority[] = { 0, 1, 3, 2, 4 };
+
+// WordClass in keywordtable.h for each category
+const int categoryClass[] = { 1, 2, 4, 3, 5 };
+
+struct Table {
+    std::vector<std::string> words;
+};
+
+struct Language {
+    std::string name;
+    Table tables[categoryCount];
+};
+
+struct PerfectHash {
+    std::vector<uint16_t> displacements;
+    std::vector<int> slots;     // index into words, -1 = empty
+};
+
+// must match keywordHash() in keywordtable.cpp
+inline uint64_t keywordHash(const std::string &word)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : word) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+inline uint32_t nextPowerOfTwo(uint32_t n)
+{
+    uint32_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+inline std::string readFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "cannot open " << path << std::endl;
+        std::exit(1);
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+inline std::string stripComments(const std::string &src)
+{
+    std::string out;
+    out.reserve(src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        if (src[i] == '"') {
+            const size_t end = src.find('"', i + 1);
+            out.append(src, i, end - i + 1);
+            i = end;
+        } else if (src.compare(i, 2, "/*") == 0) {
+            i = src.find("*/", i + 2) + 1;
+        } else if (src.compare(i, 2, "//") == 0) {
+            i = src.find('\n', i) - 1;
+        } else {
+            out += src[i];
+        }
+    }
+    return out;
+}
+
+inline int categoryIndex(const std::string &variable)
+{
+    const size_t underscore = variable.rfind('_');
+    const std::string name = underscore == std::string::npos ? variable : variable.substr(underscore + 1);
+    for (int i = 0; i < categoryCount; ++i)
+        if (name == categories[i]) return i;
+    return -1;
+}
+
+/**
+ * @brief collects the word lists of every initXxxData()/loadXxxData()
+ */
+inline std::vector<Language> parseLanguageData(const std::string &source)
+{
+    const std::string src = stripComments(source);
+    const std::regex function(R"(void\s+(?:init|load)(\w+?)Data\s*\()");
+    const std::regex assignment(R"((\w+)\s*=\s*(?:LanguageData\s*)?\{)");
+    const std::regex word(R"(QLatin1String\(\"([^\"]*)\"\))");
+
+    std::map<std::string, size_t> indexOf;
+    std::vector<Language> languages;
+
+    std::vector<std::pair<size_t, std::string>> functions;
+    for (std::sregex_iterator it(src.begin(), src.end(), function), end; it != end; ++it)
+        functions.emplace_back(it->position(), (*it)[1].str());
+
+    for (std::sregex_iterator it(src.begin(), src.end(), assignment), end; it != end; ++it) {
+        const int category = categoryIndex((*it)[1].str());
+        if (category < 0) continue;
+
+        const size_t pos = it->position();
+        std::string owner;
+        for (const auto &f : functions)
+            if (f.first < pos) owner = f.second;
+        if (owner.empty()) continue;
+
+        // find the matching closing brace
+        size_t open = pos + it->length() - 1;
+        size_t close = open;
+        for (int depth = 0; close < src.size(); ++close) {
+            if (src[close] == '{') ++depth;
+            else if (src[close] == '}' && --depth == 0) break;
+        }
+
+        if (!indexOf.count(owner)) {
+            indexOf[owner] = languages.size();
+            languages.push_back(Language{owner, {}});
+        }
+        Table &table = languages[indexOf[owner]].tables[category];
+
+        const std::string body = src.substr(open, close - open);
+        for (std::sregex_iterator w(body.begin(), body.end(), word), wend; w != wend; ++w)
+            table.words.push_back((*w)[1].str());
+    }
+
+    for (Language &lang : languages) {
+        for (Table &table : lang.tables) {
+            std::set<std::string> seen;
+            std::vector<std::string> unique;
+            for (const std::string &w : table.words)
+                if (!w.empty() && seen.insert(w).second) unique.push_back(w);
+            table.words.swap(unique);
+        }
+    }
+    return languages;
+}
+
+/**
+ * @brief builds a perfect hash (power-of-two table) with the hash and
+ * displace method
+ * @details keys are spread into buckets by the low half of the hash, the
+ * biggest buckets are placed first and each bucket gets the smallest
+ * displacement d for which all of its keys land in free slots, where
+ * slot = (high + d * (low | 1)) & (slotCount - 1)
+ */
+inline PerfectHash buildPerfectHash(const std::vector<std::string> &words)
+{
+    PerfectHash ph;
+    if (words.empty()) return ph;
+
+    const uint32_t n = static_cast<uint32_t>(words.size());
+    uint32_t slotCount = nextPowerOfTwo(n + n / 4 + 1);
+    const uint32_t bucketCount = nextPowerOfTwo(std::max<uint32_t>(1, n / 2));
+
+    std::vector<uint64_t> hashes;
+    for (const std::string &w : words) hashes.push_back(keywordHash(w));
+
+    for (;;) {
+        std::vector<std::vector<int>> buckets(bucketCount);
+        for (uint32_t i = 0; i < n; ++i)
+            buckets[static_cast<uint32_t>(hashes[i]) & (bucketCount - 1)].push_back(static_cast<int>(i));
+
+        std::vector<uint32_t> order(bucketCount);
+        for (uint32_t i = 0; i < bucketCount; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t a, uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        ph.displacements.assign(bucketCount, 0);
+        ph.slots.assign(slotCount, -1);
+
+        bool ok = true;
+        for (uint32_t b : order) {
+            const std::vector<int> &bucket = buckets[b];
+            if (bucket.empty()) break;
+
+            bool placed = false;
+            for (uint32_t d = 0; d <= 0xFFFF && !placed; ++d) {
+                std::vector<uint32_t> taken;
+                for (int k : bucket) {
+                    const uint32_t lo = static_cast<uint32_t>(hashes[k]);
+                    const uint32_t hi = static_cast<uint32_t>(hashes[k] >> 32);
+                    const uint32_t slot = (hi + d * (lo | 1)) & (slotCount - 1);
+                    if (ph.slots[slot] != -1 ||
+                        std::find(taken.begin(), taken.end(), slot) != taken.end())
+                        break;
+                    taken.push_back(slot);
+                }
+                if (taken.size() != bucket.size()) continue;
+                for (size_t k = 0; k < bucket.size(); ++k)
+                    ph.slots[taken[k]] = bucket[k];
+                ph.displacements[b] = static_cast<uint16_t>(d);
+                placed = true;
+            }
+            if (!placed) {
+                ok = false;
+                break;
+            }
+        }
+        if (ok) return ph;
+        slotCount *= 2;
+    }
+}
+
+inline std::string lowerName(const Language &lang)
+{
+    std::string name;
+    for (char c : lang.name) name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return name;
+}
+
+// KeywordTable::CaseFolding
+enum CaseFolding { MatchCase, FoldWords, FoldKeywords };
+
+// languages whose words match in any case
+const char *const caseInsensitiveLanguages[] = { "sql", "asm" };
+// languages whose keywords match in any case but whose other words don't,
+// CMake commands are case-insensitive, its variables and properties aren't
+const char *const caseInsensitiveKeywordLanguages[] = { "cmake" };
+
+inline CaseFolding caseFolding(const Language &lang)
+{
+    for (const char *name : caseInsensitiveLanguages)
+        if (lowerName(lang) == name) return FoldWords;
+    for (const char *name : caseInsensitiveKeywordLanguages)
+        if (lowerName(lang) == name) return FoldKeywords;
+    return MatchCase;
+}
+
+/**
+ * @brief lowers the words of a case-insensitive language
+ * @details the same way KeywordTable::classify() folds a word, so the
+ * lookup can hash and compare the folded word. With FoldKeywords only the
+ * keywords are lowered. Words that only differed in case keep the first
+ * one, mergeCategories() drops the rest.
+ */
+inline void foldCase(Language &lang, CaseFolding folding)
+{
+    if (folding == MatchCase) return;
+    for (int c = 0; c < categoryCount; ++c) {
+        if (folding == FoldKeywords && c != categoryIndex("keywords")) continue;
+        for (std::string &w : lang.tables[c].words)
+            for (char &ch : w)
+                if (ch >= 'A' && ch <= 'Z') ch = static_cast<char>(ch | 0x20);
+    }
+}
+
+/**
+ * @brief merges the word lists of a language into one list of words and classes
+ * @details a word in more than one list keeps the class that
+ * highlightSyntax() used to check first
+ */
+inline void mergeCategories(const Language &lang,
+                     std::vector<std::string> &words,
+                     std::vector<int> &classes)
+{
+    std::set<std::string> seen;
+    for (int c : categoryPriority) {
+        for (const std::string &w : lang.tables[c].words) {
+            if (!seen.insert(w).second) continue;
+            words.push_back(w);
+            classes.push_back(categoryClass[c]);
+        }
+    }
+}
+
+/**
+ * @brief packs every distinct word into one string
+ * @details Longer words go first, so that a word contained in one already
+ * in the pool isn't added again.
+ */
+inline std::string buildPool(const std::vector<Language> &languages, std::map<std::string, uint32_t> &offsets)
+{
+    std::set<std::string> unique;
+    for (const Language &lang : languages)
+        for (const Table &table : lang.tables)
+            unique.insert(table.words.begin(), table.words.end());
+
+    std::vector<std::string> words(unique.begin(), unique.end());
+    std::stable_sort(words.begin(), words.end(), [](const std::string &a, const std::string &b) {
+        return a.size() > b.size();
+    });
+
+    std::string pool;
+    for (const std::string &w : words) {
+        size_t offset = pool.find(w);
+        if (offset == std::string::npos) {
+            offset = pool.size();
+            pool += w;
+        }
+        offsets[w] = static_cast<uint32_t>(offset);
+    }
+    return pool;
+}
+
+} // namespace KeywordTableBuilder
+#endif // KEYWORDTABLEBUILDER_H
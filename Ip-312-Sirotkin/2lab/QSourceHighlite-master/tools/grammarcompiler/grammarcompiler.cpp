@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Compiles languages into a grammar file that QSourceHighliter::loadGrammar()
+ * maps into memory, see grammarformat.h for the layout.
+ *
+ * An input is either languagedata.cpp, whose languages get the ids, comment
+ * characters and features the highlighter gives them, or a text grammar:
+ *
+ *   # Lua, with its own keywords
+ *   language     lua
+ *   id           246
+ *   line-comment none
+ *   features     long-brackets
+ *   keywords     and break do else elseif end
+ *   keywords     for function goto if in local
+ *   literals     false nil true
+ *
+ * A file can hold several languages, each starts with a language line.
+ * Word lists are types, keywords, builtin, literals and other, a word in
+ * more than one list keeps the class of the first of types, keywords,
+ * literals, builtin and other. Repeated lines append words. line-comment is
+ * one character, or none if only // starts a line comment. The features are
+ * nested-comments, triple-quotes, long-brackets, continued-strings,
+ * case-insensitive for words that match in any case,
+ * case-insensitive-keywords for keywords that do while the other words
+ * match as listed, digit-quotes for ' between digits as in 1'000, and the
+ * extra passes
+ * css, yaml, make, asm, sql and xml. number-suffixes says what may follow
+ * a number: c (10UL, 1.0f, the default), none, rust (10u8), python (1j),
+ * css (10px) or asm (0FFh). Ids must be even and below 256, an id of a
+ * built-in language replaces it.
+ *
+ * Usage: grammarcompiler <output.qshg> <input>...
+ *
+ * It only needs a C++11 compiler.
+ */
+
+#include "../common/keywordtablebuilder.h"
+#include "../../grammarformat.h"
+
+#include <cstddef>
+
+namespace {
+
+using namespace KeywordTableBuilder;
+
+// CompiledLanguage::Flag in languageregistry.h
+const struct {
+    const char *name;
+    uint32_t flag;
+} features[] = {
+    { "css", 0x01 },
+    { "yaml", 0x02 },
+    { "make", 0x04 },
+    { "asm", 0x08 },
+    { "sql", 0x10 },
+    { "xml", 0x20 },
+    { "nested-comments", 0x40 },
+    { "triple-quotes", 0x80 },
+    { "long-brackets", 0x100 },
+    { "continued-strings", 0x200 },
+    { "case-insensitive", 0x400 },
+    { "case-insensitive-keywords", 0x800 },
+    { "digit-quotes", 0x1000 }
+};
+
+// CompiledLanguage::NumberSuffixes, in order
+const char *const numberSuffixes[] = { "c", "none", "rust", "python", "css", "asm" };
+
+struct GrammarSource {
+    Language words;
+    std::vector<int> ids;
+    char lineComment;
+    uint32_t flags;
+    uint8_t numberSuffixes;
+};
+
+/**
+ * @brief what compiledLanguage() in languageregistry.cpp uses for the
+ * languages of languagedata.cpp
+ */
+const struct {
+    const char *name;
+    int ids[2];
+    char lineComment;
+    uint32_t flags;
+    uint8_t numberSuffixes;
+} builtInLanguages[] = {
+    { "lua",        { 246 },      0,   0x100, 0 },
+    { "cpp",        { 200 },      0,   0x200 | 0x1000, 0 },
+    { "cpp",        { 204 },      0,   0x200, 0 },
+    { "js",         { 202 },      0,   0x200, 0 },
+    { "shell",      { 206 },      '#', 0, 0 },
+    { "php",        { 208 },      0,   0, 0 },
+    { "qml",        { 210 },      0,   0, 0 },
+    { "py",         { 212 },      '#', 0x80 | 0x200, 3 },
+    { "rust",       { 214 },      0,   0x40, 2 },
+    { "java",       { 216 },      0,   0, 0 },
+    { "csharp",     { 218 },      0,   0, 0 },
+    { "go",         { 220 },      0,   0, 0 },
+    { "v",          { 222 },      0,   0, 0 },
+    { "sql",        { 224 },      0,   0x10 | 0x400, 0 },
+    { "json",       { 226 },      0,   0, 1 },
+    { "css",        { 230 },      0,   0x01, 4 },
+    { "typescript", { 232 },      0,   0x200, 0 },
+    { "yaml",       { 234 },      '#', 0x02, 0 },
+    { "vex",        { 238 },      0,   0, 0 },
+    { "cmake",      { 240 },      '#', 0x800, 0 },
+    { "make",       { 242 },      '#', 0x04, 0 },
+    { "asm",        { 244 },      '#', 0x08 | 0x400, 5 },
+    { "rhai",       { 248 },      0,   0, 0 }
+};
+
+void fail(const std::string &where, const std::string &message)
+{
+    std::cerr << where << ": " << message << std::endl;
+    std::exit(1);
+}
+
+void convertLanguageData(const std::string &path, std::vector<GrammarSource> &out)
+{
+    for (const Language &lang : parseLanguageData(readFile(path))) {
+        const std::string name = lowerName(lang);
+        bool known = false;
+        for (const auto &b : builtInLanguages) {
+            if (name != b.name) continue;
+            GrammarSource g{lang, {}, b.lineComment, b.flags, b.numberSuffixes};
+            g.words.name = name;
+            for (int id : b.ids)
+                if (id) g.ids.push_back(id);
+            out.push_back(g);
+            known = true;
+        }
+        if (!known)
+            fail(path, "no id for language " + name + ", describe it in a text grammar");
+    }
+}
+
+void compileGrammar(const std::string &path, std::vector<GrammarSource> &out)
+{
+    std::istringstream in(readFile(path));
+    std::string line;
+    GrammarSource *current = nullptr;
+    for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+        const std::string where = path + ":" + std::to_string(lineNumber);
+        std::istringstream fields(line);
+        std::string key;
+        if (!(fields >> key) || key[0] == '#') continue;
+
+        std::vector<std::string> values;
+        for (std::string v; fields >> v; )
+            values.push_back(v);
+
+        if (key == "language") {
+            if (values.size() != 1) fail(where, "expected one name");
+            out.push_back(GrammarSource{Language{values[0], {}}, {}, 0, 0, 0});
+            current = &out.back();
+            continue;
+        }
+        if (!current) fail(where, "expected a language line first");
+
+        if (key == "id") {
+            for (const std::string &v : values) {
+                char *end = nullptr;
+                const long id = std::strtol(v.c_str(), &end, 10);
+                if (*end || id < 0 || id > 0xff || id % 2)
+                    fail(where, "ids must be even numbers below 256");
+                current->ids.push_back(int(id));
+            }
+        } else if (key == "line-comment") {
+            if (values.size() != 1 || (values[0] != "none" && values[0].size() != 1))
+                fail(where, "expected one character or none");
+            current->lineComment = values[0] == "none" ? 0 : values[0][0];
+        } else if (key == "number-suffixes") {
+            const auto *end = numberSuffixes + sizeof(numberSuffixes) / sizeof(*numberSuffixes);
+            const auto *found = values.size() == 1 ?
+                        std::find_if(numberSuffixes, end, [&values](const char *n) { return values[0] == n; }) : end;
+            if (found == end) fail(where, "expected one of c, none, rust, python, css or asm");
+            current->numberSuffixes = uint8_t(found - numberSuffixes);
+        } else if (key == "features") {
+            for (const std::string &v : values) {
+                bool found = false;
+                for (const auto &f : features) {
+                    if (v == f.name) {
+                        current->flags |= f.flag;
+                        found = true;
+                    }
+                }
+                if (!found) fail(where, "unknown feature " + v);
+            }
+        } else {
+            const int category = categoryIndex(key);
+            if (category < 0) fail(where, "unknown key " + key);
+            for (const std::string &w : values) {
+                for (char c : w)
+                    if (static_cast<unsigned char>(c) > 0x7f)
+                        fail(where, "words must be ASCII");
+                std::vector<std::string> &words = current->words.tables[category].words;
+                if (std::find(words.begin(), words.end(), w) == words.end())
+                    words.push_back(w);
+            }
+        }
+    }
+
+    for (const GrammarSource &g : out)
+        if (g.ids.empty()) fail(path, "language " + g.words.name + " has no id");
+}
+
+void put16(std::string &out, size_t at, uint32_t v)
+{
+    out[at] = char(v & 0xff);
+    out[at + 1] = char((v >> 8) & 0xff);
+}
+
+void put32(std::string &out, size_t at, uint32_t v)
+{
+    put16(out, at, v & 0xffff);
+    put16(out, at + 2, v >> 16);
+}
+
+void align4(std::string &out)
+{
+    out.resize((out.size() + 3) & ~size_t(3), '\0');
+}
+
+/**
+ * @brief lays out the file, in little-endian byte order whatever the host is
+ */
+std::string writeGrammar(const std::vector<GrammarSource> &sources)
+{
+    using QSourceHighlite::GrammarHeader;
+    using QSourceHighlite::GrammarLanguage;
+
+    std::vector<Language> languages;
+    size_t recordCount = 0;
+    for (const GrammarSource &g : sources) {
+        languages.push_back(g.words);
+        recordCount += g.ids.size();
+    }
+    if (recordCount > 0xffff) fail("output", "too many languages");
+
+    std::map<std::string, uint32_t> offsets;
+    std::string pool = buildPool(languages, offsets);
+    if (pool.size() > 0xffff) fail("output", "word pool too big");
+    std::vector<uint32_t> nameOffsets;
+    for (const GrammarSource &g : sources) {
+        size_t offset = pool.find(g.words.name);
+        if (offset == std::string::npos) {
+            offset = pool.size();
+            pool += g.words.name;
+        }
+        nameOffsets.push_back(uint32_t(offset));
+    }
+
+    const size_t languagesOffset = sizeof(GrammarHeader);
+    const size_t poolOffset = languagesOffset + recordCount * sizeof(GrammarLanguage);
+    std::string out(poolOffset, '\0');
+    out += pool;
+
+    size_t record = languagesOffset;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        const GrammarSource &g = sources[i];
+        std::vector<std::string> words;
+        std::vector<int> classes;
+        mergeCategories(g.words, words, classes);
+        const PerfectHash ph = buildPerfectHash(words);
+
+        size_t maxLength = 0;
+        for (const std::string &w : words)
+            maxLength = std::max(maxLength, w.size());
+        if (maxLength > 0xff) fail(g.words.name, "word too long");
+        if (ph.slots.size() > 0xffff) fail(g.words.name, "too many words");
+
+        align4(out);
+        const size_t entriesOffset = out.size();
+        for (int w : ph.slots) {
+            std::string slot(4, '\0');
+            if (w >= 0) {
+                put16(slot, 0, offsets[words[w]]);
+                slot[2] = char(words[w].size());
+                slot[3] = char(classes[w]);
+            }
+            out += slot;
+        }
+        const size_t displacementsOffset = out.size();
+        out.resize(out.size() + 2 * ph.displacements.size(), '\0');
+        for (size_t d = 0; d < ph.displacements.size(); ++d)
+            put16(out, displacementsOffset + 2 * d, ph.displacements[d]);
+
+        for (int id : g.ids) {
+            put16(out, record + offsetof(GrammarLanguage, id), uint32_t(id));
+            out[record + offsetof(GrammarLanguage, lineComment)] = g.lineComment;
+            out[record + offsetof(GrammarLanguage, maxLength)] = char(maxLength);
+            put32(out, record + offsetof(GrammarLanguage, flags), g.flags);
+            out[record + offsetof(GrammarLanguage, numberSuffixes)] = char(g.numberSuffixes);
+            put32(out, record + offsetof(GrammarLanguage, nameOffset), nameOffsets[i]);
+            put16(out, record + offsetof(GrammarLanguage, nameLength), uint32_t(g.words.name.size()));
+            put16(out, record + offsetof(GrammarLanguage, bucketCount), uint32_t(ph.displacements.size()));
+            put32(out, record + offsetof(GrammarLanguage, entriesOffset), uint32_t(entriesOffset));
+            put32(out, record + offsetof(GrammarLanguage, entryCount), uint32_t(ph.slots.size()));
+            put32(out, record + offsetof(GrammarLanguage, displacementsOffset), uint32_t(displacementsOffset));
+            record += sizeof(GrammarLanguage);
+        }
+    }
+    align4(out);
+
+    std::copy(QSourceHighlite::grammarMagic, QSourceHighlite::grammarMagic + 4, out.begin());
+    put16(out, offsetof(GrammarHeader, version), QSourceHighlite::grammarVersion);
+    put16(out, offsetof(GrammarHeader, languageCount), uint32_t(recordCount));
+    put32(out, offsetof(GrammarHeader, languagesOffset), uint32_t(languagesOffset));
+    put32(out, offsetof(GrammarHeader, poolOffset), uint32_t(poolOffset));
+    put32(out, offsetof(GrammarHeader, poolSize), uint32_t(pool.size()));
+    put32(out, offsetof(GrammarHeader, fileSize), uint32_t(out.size()));
+    return out;
+}
+
+bool endsWith(const std::string &s, const std::string &suffix)
+{
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <output.qshg> <languagedata.cpp | grammar>..." << std::endl;
+        return 1;
+    }
+
+    std::vector<GrammarSource> sources;
+    for (int i = 2; i < argc; ++i) {
+        if (endsWith(argv[i], ".cpp"))
+            convertLanguageData(argv[i], sources);
+        else
+            compileGrammar(argv[i], sources);
+    }
+
+    // KeywordTable::foldCase
+    const uint32_t caseInsensitive = 0x400;
+    const uint32_t caseInsensitiveKeywords = 0x800;
+    for (GrammarSource &g : sources)
+        foldCase(g.words, (g.flags & caseInsensitive) ? FoldWords :
+                          (g.flags & caseInsensitiveKeywords) ? FoldKeywords : MatchCase);
+
+    std::set<int> ids;
+    for (const GrammarSource &g : sources)
+        for (int id : g.ids)
+            if (!ids.insert(id).second)
+                fail(g.words.name, "id " + std::to_string(id) + " is used twice");
+
+    const std::string grammar = writeGrammar(sources);
+    std::ofstream out(argv[1], std::ios::binary);
+    out.write(grammar.data(), std::streamsize(grammar.size()));
+    if (!out) fail(argv[1], "can't be written");
+
+    std::cout << "wrote " << ids.size() << " languages, " << grammar.size() << " bytes" << std::endl;
+    return 0;
+}
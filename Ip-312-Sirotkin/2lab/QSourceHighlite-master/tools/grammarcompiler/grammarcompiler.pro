@@ -0,0 +1,12 @@
+TEMPLATE = app
+CONFIG  += console c++11
+CONFIG  -= qt app_bundle
+
+TARGET = grammarcompiler
+
+SOURCES += \
+    grammarcompiler.cpp
+
+HEADERS += \
+    ../common/keywordtablebuilder.h \
+    ../../grammarformat.h
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2019-2020 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Generates languagetables.h/.cpp from languagedata.cpp.
+ *
+ * The word lists of every language are merged into one perfect hash table
+ * (hash and displace, power-of-two table) that also stores the class of
+ * each word, so the highlighter can classify a word with one hash and one
+ * memcmp. The output is plain constant data and needs no initialization at
+ * startup.
+ *
+ * The characters of all words of all languages are stored once, in one
+ * shared pool: a word that repeats across languages, or that is part of a
+ * longer word, points into the same characters.
+ *
+ * Usage: languagetablesgen <path/to/languagedata.cpp> <output dir>
+ *
+ * Rerun it whenever languagedata.cpp changes. It only needs a C++11 compiler.
+ */
+
+#include "../common/keywordtablebuilder.h"
+
+namespace {
+
+using namespace KeywordTableBuilder;
+
+const char *const licenseHeader =
+    "/*\n"
+    " * This file is generated by tools/languagetablesgen from languagedata.cpp.\n"
+    " * Do not edit it by hand, edit languagedata.cpp and rerun the generator.\n"
+    " */\n\n";
+
+void writeHeader(const std::vector<Language> &languages, std::ostream &out)
+{
+    out << licenseHeader
+        << "#ifndef QSOURCEHIGHLITE_LANGUAGETABLES_H\n"
+        << "#define QSOURCEHIGHLITE_LANGUAGETABLES_H\n\n"
+        << "#include \"keywordtable.h\"\n\n"
+        << "namespace QSourceHighlite {\n\n";
+    for (const Language &lang : languages)
+        out << "extern const KeywordTable " << lowerName(lang) << "Keywords;\n";
+    out << "\n}\n#endif // QSOURCEHIGHLITE_LANGUAGETABLES_H\n";
+}
+
+void writeString(const std::string &s, std::ostream &out)
+{
+    const size_t perLine = 96;
+    if (s.empty()) out << "\n    \"\"";
+    for (size_t i = 0; i < s.size(); i += perLine) {
+        out << "\n    \"";
+        for (char c : s.substr(i, perLine)) {
+            if (c == '"' || c == '\\') out << '\\';
+            out << c;
+        }
+        out << '"';
+    }
+}
+
+void writeSource(const std::vector<Language> &languages, std::ostream &out)
+{
+    out << licenseHeader
+        << "#include \"languagetables.h\"\n\n"
+        << "namespace QSourceHighlite {\n";
+
+    std::map<std::string, uint32_t> offsets;
+    const std::string pool = buildPool(languages, offsets);
+    if (pool.size() > 0xFFFF) {
+        std::cerr << "word pool too big" << std::endl;
+        std::exit(1);
+    }
+
+    out << "\n// the words of all languages, see KeywordSlot\n"
+        << "static const char wordPool[] =";
+    writeString(pool, out);
+    out << ";\n";
+
+    for (const Language &lang : languages) {
+        std::vector<std::string> words;
+        std::vector<int> classes;
+        mergeCategories(lang, words, classes);
+
+        const std::string id = lowerName(lang) + "Keywords";
+        if (words.empty()) {
+            out << "\nconst KeywordTable " << id << " = { nullptr, nullptr, nullptr, 0, 0, 0, 0 };\n";
+            continue;
+        }
+
+        const PerfectHash ph = buildPerfectHash(words);
+
+        size_t maxLength = 0;
+        for (const std::string &w : words)
+            maxLength = std::max(maxLength, w.size());
+        if (maxLength > 0xFF) {
+            std::cerr << id << ": word too long" << std::endl;
+            std::exit(1);
+        }
+
+        out << "static const KeywordSlot " << id << "Entries[" << ph.slots.size() << "] = {";
+        for (size_t i = 0; i < ph.slots.size(); ++i) {
+            if (i % 6 == 0) out << "\n   ";
+            const int w = ph.slots[i];
+            if (w < 0) out << " {0, 0, 0},";
+            else out << " {" << offsets[words[w]] << ", " << words[w].size() << ", " << classes[w] << "},";
+        }
+        out << "\n};\n";
+
+        out << "static const quint16 " << id << "Displacements[" << ph.displacements.size() << "] = {";
+        for (size_t i = 0; i < ph.displacements.size(); ++i) {
+            if (i % 16 == 0) out << "\n   ";
+            out << ' ' << ph.displacements[i] << ',';
+        }
+        out << "\n};\n";
+
+        out << "const KeywordTable " << id << " = { "
+            << "wordPool, " << id << "Entries, " << id << "Displacements, "
+            << ph.slots.size() << ", " << ph.displacements.size() << ", " << maxLength << ", "
+            << caseFolding(lang) << " };\n";
+    }
+
+    out << "\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <languagedata.cpp> <output dir>" << std::endl;
+        return 1;
+    }
+
+    std::vector<Language> languages = parseLanguageData(readFile(argv[1]));
+    for (Language &lang : languages)
+        foldCase(lang, caseFolding(lang));
+    const std::string dir = argv[2];
+
+    std::ofstream header(dir + "/languagetables.h", std::ios::binary);
+    writeHeader(languages, header);
+    std::ofstream source(dir + "/languagetables.cpp", std::ios::binary);
+    writeSource(languages, source);
+
+    size_t words = 0;
+    for (const Language &lang : languages)
+        for (const Table &t : lang.tables) words += t.words.size();
+    std::cout << "wrote " << languages.size() << " languages, " << words << " words" << std::endl;
+    return 0;
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+CONFIG  += console c++11
+CONFIG  -= qt app_bundle
+
+TARGET = languagetablesgen
+
+SOURCES += \
+    languagetablesgen.cpp
+
+HEADERS += \
+    ../common/keywordtablebuilder.h